@@ -53,6 +53,18 @@ struct cprop_functor  : public functor_t {
       void lpm_compare_eq_(Design*des, const NetCompare*obj);
  };
 
+/*
+ * When an optimization replaces or removes a node, the nodes that
+ * share a nexus with it may now be candidates for further
+ * optimization. Mark them so that the next (incremental) iteration
+ * looks at them again.
+ */
+static void mark_neighbors(Design*des, NetNode*obj)
+{
+      for (unsigned idx = 0 ; idx < obj->pin_count() ; idx += 1)
+	    des->functor_mark(obj->pin(idx).nexus());
+}
+
 void cprop_functor::signal(Design*, NetNet*)
 {
 }
@@ -115,6 +127,7 @@ void cprop_functor::lpm_concat(Design*des, NetConcat*obj)
       result_obj->set_line(*obj);
       des->add_node(result_obj);
       connect(obj->pin(0), result_obj->pin(0));
+      mark_neighbors(des, obj);
 
 	// Note that this will leave the const inputs to dangle. They
 	// will be reaped by other passes of cprop_functor.
@@ -189,8 +202,10 @@ void cprop_functor::lpm_mux(Design*des, NetMux*obj)
 	    connect(tmp->pin(1), obj->pin_Data(1));
       else
 	    connect(tmp->pin(1), obj->pin_Data(0));
+      mark_neighbors(des, obj);
       delete obj;
       des->add_node(tmp);
+      des->functor_mark(tmp);
       count += 1;
 }
 
@@ -324,6 +339,7 @@ void cprop_functor::lpm_part_select(Design*des, NetPartSelect*obj)
       ivl_assert(*obj, concat_pin == cncat->pin_count());
 
       for (size_t idx = 0 ; idx < obj_set.size() ; idx += 1) {
+	    mark_neighbors(des, obj_set[idx]);
 	    delete obj_set[idx];
       }
 
@@ -429,17 +445,27 @@ void cprop_dc_functor::lpm_const(Design*, NetConst*obj)
 
 void cprop(Design*des)
 {
-	// Continually propagate constants until a scan finds nothing
-	// to do.
+	// Scan the whole design once, then continually revisit the
+	// nodes around the changes made by the previous iteration
+	// until an iteration finds nothing more to do. This avoids
+	// rescanning the entire netlist for each iteration.
       cprop_functor prop;
-      do {
+      prop.count = 0;
+      des->functor(&prop);
+      if (verbose_flag) {
+	    cout << " ... Full scan detected "
+		 << prop.count << " optimizations." << endl << flush;
+      }
+
+      while (prop.count > 0) {
 	    prop.count = 0;
-	    des->functor(&prop);
+	    unsigned visited = des->functor_marked(&prop);
 	    if (verbose_flag) {
-		  cout << " ... Iteration detected "
+		  cout << " ... Iteration revisited " << visited
+		       << " nodes and detected "
 		       << prop.count << " optimizations." << endl << flush;
 	    }
-      } while (prop.count > 0);
+      }
 
       if (verbose_flag) {
 	    cout << " ... Look for dangling constants" << endl << flush;
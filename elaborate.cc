@@ -7186,6 +7186,7 @@ Design* elaborate(list<perm_string>roots)
 	// Run the work list of scope elaborations until the list is
 	// empty. This list is initially populated above where the
 	// initial root scopes are primed.
+      unsigned elab_pass = 0;
       while (! des->elaboration_work_list.empty()) {
 	      // Push a work item to process the defparams of any scopes
 	      // that are elaborated during this pass. For the first pass
@@ -7194,12 +7195,18 @@ Design* elaborate(list<perm_string>roots)
 	      // by a generate construct or instance array.
 	    des->elaboration_work_list.push_back(new top_defparams(des));
 
-	      // Transfer the queue to a temporary queue.
+	      // Transfer the queue to a temporary queue. The items of a
+	      // pass do not depend on each other's new work items, which
+	      // only run in the next pass.
 	    list<elaborator_work_item_t*> cur_queue;
-	    while (! des->elaboration_work_list.empty()) {
-		  cur_queue.push_back(des->elaboration_work_list.front());
-		  des->elaboration_work_list.pop_front();
+	    cur_queue.swap(des->elaboration_work_list);
+
+	    if (debug_elaborate) {
+		  cerr << "<toplevel>: elaborate: "
+		       << "elaboration work pass " << elab_pass
+		       << ", " << cur_queue.size() << " items." << endl;
 	    }
+	    elab_pass += 1;
 
 	      // Run from the temporary queue. If the temporary queue
 	      // items create new work queue items, they will show up
@@ -183,6 +183,50 @@ void Design::functor(functor_t*fun)
       }
 }
 
+void Design::functor_mark(NetNode*net)
+{
+	// Only nodes that are part of the design can be visited.
+      if (net->design_ != this)
+	    return;
+
+      if (nodes_marked_.insert(net).second)
+	    nodes_marked_list_.push_back(net);
+}
+
+void Design::functor_mark(Nexus*nex)
+{
+      for (Link*cur = nex->first_nlink() ; cur ; cur = cur->next_nlink()) {
+	    NetNode*net = dynamic_cast<NetNode*>(cur->get_obj());
+	    if (net) functor_mark(net);
+      }
+}
+
+unsigned Design::functor_marked(functor_t*fun)
+{
+	/* Take the current list of marked nodes. Nodes that the
+	   functor marks while this list is being processed are
+	   collected for the next call. A node that was deleted since
+	   it was marked is no longer in the nodes_marked_ set (see
+	   Design::del_node) so it is skipped. */
+      list<NetNode*> work;
+      work.swap(nodes_marked_list_);
+
+      unsigned visited = 0;
+      while (! work.empty()) {
+	    NetNode*cur = work.front();
+	    work.pop_front();
+
+	    set<NetNode*>::iterator mark = nodes_marked_.find(cur);
+	    if (mark == nodes_marked_.end())
+		  continue;
+
+	    nodes_marked_.erase(mark);
+	    cur->functor_node(this, fun);
+	    visited += 1;
+      }
+
+      return visited;
+}
 
 void NetNode::functor_node(Design*, functor_t*)
 {
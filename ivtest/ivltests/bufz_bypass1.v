@@ -0,0 +1,20 @@
+// Check that nets in a chain of continuous assignments still report
+// the right values when they are looked up by name ($monitor).
+module test;
+
+reg [3:0] r;
+wire [3:0] w1, w2, w3;
+
+assign w1 = r;
+assign w2 = w1;
+assign w3 = w2;
+
+initial begin
+   $monitor("%0t: w2=%b w3=%b", $time, test.w2, w3);
+   r = 4'b0000;
+   #1 r = 4'b1010;
+   #1 r = 4'bxz01;
+   #1 $finish(0);
+end
+
+endmodule
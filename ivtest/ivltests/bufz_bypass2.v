@@ -0,0 +1,45 @@
+// Check that a long chain of pass-through assignments delivers every
+// value change to the end of the chain, once.
+module test;
+
+reg [7:0] src;
+wire [7:0] w1, w2, w3, w4, w5, w6;
+wire parity;
+integer changes = 0;
+reg failed;
+
+assign w1 = src;
+assign w2 = w1;
+assign w3 = w2;
+assign w4 = w3;
+assign w5 = w4;
+assign w6 = w5;
+assign parity = ^w6;
+
+always @(w6) changes = changes + 1;
+
+initial begin
+   failed = 0;
+   src = 8'h00;
+   #1 changes = 0;
+   src = 8'h5a;
+   #1 src = 8'h5a;
+   #1 src = 8'hzx;
+   #1 src = 8'hff;
+   #1;
+   if (w6 !== 8'hff || parity !== 1'b0) begin
+      $display("FAILED -- w6=%h, parity=%b", w6, parity);
+      failed = 1;
+   end
+   if (changes !== 3) begin
+      $display("FAILED -- %0d changes, expecting 3", changes);
+      failed = 1;
+   end
+   if (w3 !== w6) begin
+      $display("FAILED -- w3=%h, w6=%h", w3, w6);
+      failed = 1;
+   end
+   if (!failed) $display("PASSED");
+end
+
+endmodule
@@ -0,0 +1,38 @@
+// Check that forcing and releasing a net in the middle of a chain of
+// pass-through assignments still works.
+module test;
+
+reg [3:0] r;
+wire [3:0] a, b, c;
+reg failed;
+
+assign a = r;
+assign b = a;
+assign c = b;
+
+task check(input [3:0] ea, input [3:0] eb, input [3:0] ec);
+   if (a !== ea || b !== eb || c !== ec) begin
+      $display("FAILED -- %0t: a=%h b=%h c=%h, expecting %h %h %h",
+               $time, a, b, c, ea, eb, ec);
+      failed = 1;
+   end
+endtask
+
+initial begin
+   failed = 0;
+   r = 4'h3;
+   #1 check(4'h3, 4'h3, 4'h3);
+   force b = 4'hc;
+   #1 check(4'h3, 4'hc, 4'hc);
+   r = 4'h5;
+   #1 check(4'h5, 4'hc, 4'hc);
+   release b;
+   #1 check(4'h5, 4'h5, 4'h5);
+   force a = 4'h9;
+   #1 check(4'h9, 4'h9, 4'h9);
+   release a;
+   #1 check(4'h5, 4'h5, 4'h5);
+   if (!failed) $display("PASSED");
+end
+
+endmodule
@@ -0,0 +1,73 @@
+// Test repeated constant function calls with identical arguments.
+module constfunc16_sub #(parameter SCALE = 1) (output [31:0] value);
+
+function automatic integer fib(input integer n);
+begin
+  if (n < 2)
+    fib = n;
+  else
+    fib = fib(n - 1) + fib(n - 2);
+end
+endfunction
+
+function integer scaled(input integer n);
+begin
+  scaled = n * SCALE;
+end
+endfunction
+
+localparam integer res = scaled(fib(20));
+
+assign value = res;
+
+endmodule
+
+module constfunc16();
+
+function [7:0] ext(input [3:0] in);
+begin
+  ext = in;
+end
+endfunction
+
+function signed [7:0] sext(input signed [3:0] in);
+begin
+  sext = in;
+end
+endfunction
+
+localparam [7:0] res1 = ext(4'b1010);
+localparam [7:0] res2 = ext(4'b1010);
+localparam [7:0] res3 = sext(4'sb1010);
+localparam [7:0] res4 = sext(4'b1010);
+localparam [7:0] res5 = ext(4'b10x0);
+localparam [7:0] res6 = ext(4'b10z0);
+
+wire [31:0] val1, val2;
+
+constfunc16_sub #(1) inst1(val1);
+constfunc16_sub #(3) inst2(val2);
+
+reg failed = 0;
+
+initial begin
+  #1;
+  $display("%h %h %h %h %h %h", res1, res2, res3, res4, res5, res6);
+  if (res1 !== 8'h0a) failed = 1;
+  if (res2 !== 8'h0a) failed = 1;
+  if (res3 !== 8'hfa) failed = 1;
+  if (res4 !== 8'hfa) failed = 1;
+  if (res5 !== 8'b0000_10x0) failed = 1;
+  if (res6 !== 8'b0000_10z0) failed = 1;
+
+  $display("%0d %0d", val1, val2);
+  if (val1 !== 6765) failed = 1;
+  if (val2 !== 20295) failed = 1;
+
+  if (failed)
+    $display("FAILED");
+  else
+    $display("PASSED");
+end
+
+endmodule
@@ -0,0 +1,48 @@
+// Check that statement coverage counters (-pcoverage=1) do not change
+// the behavior of procedural code.
+module test;
+
+reg [7:0] count;
+integer i;
+reg failed;
+
+task bump;
+   count = count + 1;
+endtask
+
+function [7:0] twice(input [7:0] val);
+   twice = val * 2;
+endfunction
+
+initial begin
+   failed = 0;
+   count = 0;
+   for (i = 0 ; i < 10 ; i = i + 1) begin
+      if (i[0])
+        bump;
+      else
+        count = count + 2;
+   end
+   if (count !== 15) begin
+      $display("FAILED -- count=%0d, expecting 15", count);
+      failed = 1;
+   end
+
+   case (twice(count))
+     30: count = 0;
+     default: begin
+        $display("FAILED -- twice(%0d) = %0d", count, twice(count));
+        failed = 1;
+     end
+   endcase
+
+   #1 while (count < 3) count = count + 1;
+   if (count !== 3) begin
+      $display("FAILED -- count=%0d, expecting 3", count);
+      failed = 1;
+   end
+
+   if (!failed) $display("PASSED");
+end
+
+endmodule
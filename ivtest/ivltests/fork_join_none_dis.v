@@ -0,0 +1,29 @@
+/*
+ * Disable a named block whose thread still has running join_none
+ * children. The block must stop, and the detached children must keep
+ * running to completion.
+ */
+module main;
+
+   int count;
+
+   initial begin : blk
+      count = 0;
+      fork : workers
+	 repeat (4) #2 count = count + 1;
+	 #1 count = count + 10;
+      join_none
+      #100 $display("FAILED -- blk was not disabled");
+   end
+
+   initial begin
+      #3 disable blk;
+      #10 if (count !== 14) begin
+	 $display("FAILED -- count=%0d (s.b. 14)", count);
+	 $finish;
+      end
+      $display("PASSED");
+      $finish;
+   end
+
+endmodule
@@ -0,0 +1,25 @@
+// Check that each test started by $fork_tests sees its own +args in
+// front of the command line ones, along with its own +fork_test_index.
+module test;
+
+integer fd, test_case, index;
+
+initial begin
+  fd = $fopen("work/fork_tests1.txt", "w");
+  $fdisplay(fd, "+case=1");
+  $fdisplay(fd, "+case=2");
+  $fclose(fd);
+
+  #1 $fork_tests("work/fork_tests1.txt");
+
+  if (!$value$plusargs("case=%d", test_case))
+    $display("FAILED: no +case argument");
+  else if (!$value$plusargs("fork_test_index=%d", index))
+    $display("FAILED: case %0d has no +fork_test_index argument", test_case);
+  else if (index != test_case)
+    $display("FAILED: case %0d has index %0d", test_case, index);
+  else
+    $display("case %0d PASSED", test_case);
+end
+
+endmodule
@@ -0,0 +1,107 @@
+// Check that conditional jumps still go the right way after vvp has
+// shortened the jump chains at load time. The conditions are 0, 1, x
+// and z, in nested if/else statements, case arms and loops. An empty
+// forever loop, which is a jump to itself, is loaded but not entered.
+module test;
+
+reg [3:0] vals;
+reg a, b, never;
+reg [1:0] s;
+integer i, j, count;
+reg failed;
+
+function integer nested(input a, input b);
+   if (a)
+      if (b)
+         nested = 1;
+      else
+         nested = 2;
+   else if (b)
+      nested = 3;
+   else
+      nested = 4;
+endfunction
+
+function integer arms(input [1:0] s);
+   case (s)
+     2'b00: arms = 0;
+     2'b01: if (s[1]) arms = 9;
+            else if (s[0]) arms = 1;
+            else arms = 9;
+     2'b1x: arms = 2;
+     2'bz0: arms = 3;
+     default: if (s[0]) arms = 4;
+              else arms = 5;
+   endcase
+endfunction
+
+initial begin
+   failed = 0;
+   vals = 4'bzx10;
+   never = 0;
+
+   if (never)
+      forever begin end
+
+   for (i = 0 ; i < 4 ; i = i + 1) begin
+      a = vals[i];
+      for (j = 0 ; j < 4 ; j = j + 1) begin
+         b = vals[j];
+         if (nested(a, b) !== (a === 1'b1 ? (b === 1'b1 ? 1 : 2)
+                                          : (b === 1'b1 ? 3 : 4))) begin
+            $display("FAILED -- nested(%b, %b) = %0d", a, b, nested(a, b));
+            failed = 1;
+         end
+
+         s = {a, b};
+         case (s)
+           2'b00: count = 0;
+           2'b01: count = 1;
+           2'b1x: count = 2;
+           2'bz0: count = 3;
+           default: count = s[0] === 1'b1 ? 4 : 5;
+         endcase
+         if (arms(s) !== count) begin
+            $display("FAILED -- arms(%b) = %0d, expecting %0d",
+                     s, arms(s), count);
+            failed = 1;
+         end
+      end
+   end
+
+     // A loop whose body ends in nested branches, so that the jumps
+     // out of the branches lead to the loop test.
+   count = 0;
+   for (i = 0 ; i < 4 ; i = i + 1) begin
+      if (vals[i])
+         if (vals[3-i])
+            count = count + 1;
+         else
+            count = count + 10;
+      else if (vals[3-i] === 1'bz)
+         count = count + 100;
+      else
+         count = count + 1000;
+   end
+   if (count !== 2110) begin
+      $display("FAILED -- loop count = %0d, expecting 2110", count);
+      failed = 1;
+   end
+
+   i = 0;
+   while (vals[i] !== 1'bz)
+      if (vals[i] === 1'bx)
+         i = i + 1;
+      else if (vals[i])
+         i = i + 1;
+      else
+         i = i + 1;
+   if (i !== 3) begin
+      $display("FAILED -- while stopped at %0d, expecting 3", i);
+      failed = 1;
+   end
+
+   if (!failed) $display("PASSED");
+end
+
+endmodule
@@ -0,0 +1,68 @@
+// Check that $save_state and $restore_state round trip the values of
+// variables and memories, including x and z bits.
+
+module sub;
+   reg [3:0] nib;
+endmodule
+
+module main;
+
+   reg [69:0] wide;
+   integer    cnt;
+   real       r;
+   reg [7:0]  mem [0:15];
+   reg	      error;
+   integer    idx;
+
+   sub u1();
+
+   initial begin
+      error = 0;
+
+      wide = 70'h2a_1234_5678_9abc_def0;
+      wide[3:0] = 4'bxz10;
+      cnt = -7;
+      r = 2.5;
+      u1.nib = 4'b1z0x;
+      for (idx = 0 ; idx < 16 ; idx = idx + 1)
+	mem[idx] = idx * 17;
+
+      $save_state("work/save_state1.state");
+
+      wide = 0;
+      cnt = 0;
+      r = 0.0;
+      u1.nib = 0;
+      for (idx = 0 ; idx < 16 ; idx = idx + 1)
+	mem[idx] = 8'bx;
+
+      $restore_state("work/save_state1.state");
+
+      if (wide !== {66'h2a_1234_5678_9abc_def, 4'bxz10}) begin
+	 $display("FAILED -- wide = %h", wide);
+	 error = 1;
+      end
+      if (cnt !== -7) begin
+	 $display("FAILED -- cnt = %0d", cnt);
+	 error = 1;
+      end
+      if (r != 2.5) begin
+	 $display("FAILED -- r = %f", r);
+	 error = 1;
+      end
+      if (u1.nib !== 4'b1z0x) begin
+	 $display("FAILED -- u1.nib = %b", u1.nib);
+	 error = 1;
+      end
+      for (idx = 0 ; idx < 16 ; idx = idx + 1)
+	if (mem[idx] !== idx * 17) begin
+	   $display("FAILED -- mem[%0d] = %h", idx, mem[idx]);
+	   error = 1;
+	end
+
+      if (error == 0)
+	$display("PASSED");
+      $finish;
+   end
+
+endmodule
@@ -0,0 +1,62 @@
+// Check that very large memories, which vvp stores sparsely, still
+// read as X where they have not been written, and that writes through
+// procedural assignment, part selects and $readmemh all land where
+// they should.
+
+module main;
+
+reg [63:0] mem [0:(1<<24)-1];
+reg [99:0] wide [0:(1<<21)-1];
+reg error;
+integer idx;
+
+initial begin
+   error = 0;
+
+   if (mem[0] !== 64'bx || mem[(1<<24)-1] !== 64'bx) begin
+      $display("FAILED -- unwritten word is not X");
+      error = 1;
+   end
+
+   for (idx = 0 ; idx < 64 ; idx = idx + 1)
+     mem[idx * 65537] = idx;
+
+   for (idx = 0 ; idx < 64 ; idx = idx + 1)
+     if (mem[idx * 65537] !== idx) begin
+	$display("FAILED -- mem[%0d] = %h", idx * 65537, mem[idx * 65537]);
+	error = 1;
+     end
+
+   if (mem[65538] !== 64'bx) begin
+      $display("FAILED -- mem[65538] = %h", mem[65538]);
+      error = 1;
+   end
+
+   mem[12345][15:8] = 8'ha5;
+   if (mem[12345] !== {48'bx, 8'ha5, 8'bx}) begin
+      $display("FAILED -- mem[12345] = %h", mem[12345]);
+      error = 1;
+   end
+
+   $readmemh("ivltests/readmemh1.dat", mem, 24'h800000);
+   for (idx = 0 ; idx < 8 ; idx = idx + 1)
+     if (mem[24'h800000 + idx] !== idx) begin
+	$display("FAILED -- mem[%h] = %h", 24'h800000 + idx, mem[24'h800000 + idx]);
+	error = 1;
+     end
+
+   wide[(1<<21)-1] = {4'h9, 96'h0123_4567_89ab_cdef_fedc_ba98};
+   if (wide[(1<<21)-1] !== {4'h9, 96'h0123_4567_89ab_cdef_fedc_ba98}) begin
+      $display("FAILED -- wide[last] = %h", wide[(1<<21)-1]);
+      error = 1;
+   end
+   if (wide[(1<<21)-2] !== 100'bx) begin
+      $display("FAILED -- wide[last-1] = %h", wide[(1<<21)-2]);
+      error = 1;
+   end
+
+   if (error == 0)
+     $display("PASSED");
+end
+
+endmodule
@@ -111,12 +111,18 @@ StringHeapLex::StringHeapLex()
       hit_count_ = 0;
       add_count_ = 0;
 
-      for (unsigned idx = 0 ;  idx < HASH_SIZE ;  idx += 1)
-	    hash_table_[idx] = 0;
+      hash_size_ = INITIAL_HASH_SIZE;
+      hash_used_ = 0;
+      hash_table_ = new hash_entry_t[hash_size_];
+      for (unsigned idx = 0 ;  idx < hash_size_ ;  idx += 1) {
+	    hash_table_[idx].text = 0;
+	    hash_table_[idx].hash = 0;
+      }
 }
 
 StringHeapLex::~StringHeapLex()
 {
+      delete[]hash_table_;
 }
 
 void StringHeapLex::cleanup()
@@ -129,9 +135,11 @@ void StringHeapLex::cleanup()
       string_pool = NULL;
       string_pool_count = 0;
 
-      for (unsigned idx = 0 ;  idx < HASH_SIZE ;  idx += 1) {
-	    hash_table_[idx] = 0;
+      for (unsigned idx = 0 ;  idx < hash_size_ ;  idx += 1) {
+	    hash_table_[idx].text = 0;
+	    hash_table_[idx].hash = 0;
       }
+      hash_used_ = 0;
 #endif
 }
 
@@ -145,36 +153,78 @@ unsigned StringHeapLex::add_count() const
       return add_count_;
 }
 
+/*
+ * This is the 32bit FNV-1a hash. It spreads the similar names that
+ * are typical of identifiers (foo_1, foo_2, ...) well over the low
+ * bits that are used to index the table.
+ */
 static unsigned hash_string(const char*text)
 {
-      unsigned h = 0;
+      unsigned h = 2166136261U;
 
       while (*text) {
-	    h = (h << 4) ^ (h >> 28) ^ *text;
+	    h ^= (unsigned char)*text;
+	    h *= 16777619U;
 	    text += 1;
       }
       return h;
 }
 
-const char* StringHeapLex::add(const char*text)
+/*
+ * Double the size of the hash table and move the entries into their
+ * new slots. The saved hashes make this cheap.
+ */
+void StringHeapLex::grow_table_()
 {
-      unsigned hash_value = hash_string(text) % HASH_SIZE;
+      unsigned new_size = hash_size_ * 2;
+      hash_entry_t*new_table = new hash_entry_t[new_size];
+      for (unsigned idx = 0 ;  idx < new_size ;  idx += 1) {
+	    new_table[idx].text = 0;
+	    new_table[idx].hash = 0;
+      }
 
-	/* If we easily find the string in the hash table, then return
-	   that and be done. */
-      if (hash_table_[hash_value]
-	  && (strcmp(hash_table_[hash_value], text) == 0)) {
-	    hit_count_ += 1;
-	    return hash_table_[hash_value];
+      for (unsigned idx = 0 ;  idx < hash_size_ ;  idx += 1) {
+	    if (hash_table_[idx].text == 0)
+		  continue;
+	    unsigned slot = hash_table_[idx].hash & (new_size-1);
+	    while (new_table[slot].text)
+		  slot = (slot + 1) & (new_size-1);
+	    new_table[slot] = hash_table_[idx];
       }
 
-	/* The existing hash entry is not a match. Replace it with the
-	   newly allocated value, and return the new pointer as the
-	   result to the add. */
+      delete[]hash_table_;
+      hash_table_ = new_table;
+      hash_size_ = new_size;
+}
+
+const char* StringHeapLex::add(const char*text)
+{
+      unsigned hash_value = hash_string(text);
+      unsigned slot = hash_value & (hash_size_-1);
+
+	/* Probe for the string. The saved hash is checked first so
+	   that strcmp is only called for a probable match. */
+      while (hash_table_[slot].text) {
+	    if (hash_table_[slot].hash == hash_value
+		&& strcmp(hash_table_[slot].text, text) == 0) {
+		  hit_count_ += 1;
+		  return hash_table_[slot].text;
+	    }
+	    slot = (slot + 1) & (hash_size_-1);
+      }
+
+	/* This is a new string. Allocate it and put it in the empty
+	   slot that the probe stopped at. Keep the table at most half
+	   full so that the probe sequences stay short. */
       const char*res = StringHeap::add(text);
-      hash_table_[hash_value] = res;
+      hash_table_[slot].text = res;
+      hash_table_[slot].hash = hash_value;
+      hash_used_ += 1;
       add_count_ += 1;
 
+      if (2*hash_used_ > hash_size_)
+	    grow_table_();
+
       return res;
 }
 
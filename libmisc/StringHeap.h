@@ -85,10 +85,13 @@ class StringHeap {
 };
 
 /*
- * A lexical string heap is a string heap that makes an effort to
- * return the same pointer for identical strings. This saves further
- * space by not allocating duplicate strings, so in a system with lots
- * of identifiers, this can theoretically save more space.
+ * A lexical string heap is a string heap that returns the same
+ * pointer for identical strings. This saves further space by not
+ * allocating duplicate strings, and makes the perm_string compare of
+ * two identifiers from the same heap a pointer compare when they
+ * match. The strings are kept in an open addressed hash table that
+ * grows with the number of strings, and the hash of each string is
+ * kept with it so that a probe only calls strcmp on a likely match.
  */
 class StringHeapLex  : private StringHeap {
 
@@ -105,8 +108,17 @@ class StringHeapLex  : private StringHeap {
       void cleanup();
 
     private:
-      enum { HASH_SIZE = 4096 };
-      const char*hash_table_[HASH_SIZE];
+      struct hash_entry_t {
+	    const char*text;
+	    unsigned hash;
+      };
+      enum { INITIAL_HASH_SIZE = 4096 };
+	// The table size is always a power of 2.
+      hash_entry_t*hash_table_;
+      unsigned hash_size_;
+      unsigned hash_used_;
+
+      void grow_table_();
 
       unsigned add_count_;
       unsigned hit_count_;
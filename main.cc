@@ -1284,7 +1284,16 @@ int main(int argc, char*argv[])
 	    net_func_queue.pop();
 	    if (verbose_flag)
 		  cerr<<" -F "<<net_func_to_name(func)<< " ..." <<endl;
+	    struct tms func_start;
+	    if (times_flag)
+		  times(&func_start);
 	    func(des);
+	    if (verbose_flag && times_flag) {
+		  struct tms func_done;
+		  times(&func_done);
+		  cerr<<" -F "<<net_func_to_name(func)<< " done, "
+		      <<cycles_diff(&func_done, &func_start)<<" seconds."<<endl;
+	    }
       }
 
       if (verbose_flag) {
@@ -1051,6 +1051,10 @@ void Design::del_node(NetNode*net)
       if (net == nodes_functor_cur_)
 	    nodes_functor_cur_ = 0;
 
+	/* A deleted node must not be visited by the incremental
+	   functor. */
+      nodes_marked_.erase(net);
+
 	/* Now perform the actual delete. */
       if (nodes_ == net)
 	    nodes_ = net->node_prev_;
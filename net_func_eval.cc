@@ -57,8 +57,72 @@ static NetExpr* fix_assign_value(const NetNet*lhs, NetExpr*rhs)
       return rhs;
 }
 
+/*
+ * Encode the (already width-fixed) argument values of a constant
+ * function call into a string that can be used as a key for the
+ * function result cache. If any argument is not a simple constant,
+ * return false and leave the call uncached.
+ */
+static bool make_eval_cache_key(const vector<NetExpr*>&args, string&key)
+{
+      key.clear();
+      for (size_t idx = 0 ; idx < args.size() ; idx += 1) {
+	    if (const NetEConst*ce = dynamic_cast<const NetEConst*>(args[idx])) {
+		  const verinum&val = ce->value();
+		  key += 'v';
+		  key += val.has_sign()? 's' : 'u';
+		  key += val.is_string()? 't' : 'n';
+		  for (unsigned bit = 0 ; bit < val.len() ; bit += 1) {
+			switch (val.get(bit)) {
+			    case verinum::V0: key += '0'; break;
+			    case verinum::V1: key += '1'; break;
+			    case verinum::Vx: key += 'x'; break;
+			    case verinum::Vz: key += 'z'; break;
+			}
+		  }
+		  key += ';';
+
+	    } else if (const NetECReal*re = dynamic_cast<const NetECReal*>(args[idx])) {
+		  double dval = re->value().as_double();
+		  key += 'r';
+		  key.append(reinterpret_cast<const char*>(&dval), sizeof dval);
+		  key += ';';
+
+	    } else {
+		  return false;
+	    }
+      }
+      return true;
+}
+
 NetExpr* NetFuncDef::evaluate_function(const LineInfo&loc, const std::vector<NetExpr*>&args) const
 {
+	// Fix up the input values to match the port types. These are
+	// the values that the function body sees, so they are also
+	// what the result cache is keyed on.
+      ivl_assert(loc, port_count() == args.size());
+      vector<NetExpr*>fixed_args (port_count());
+      for (size_t idx = 0 ; idx < port_count() ; idx += 1)
+	    fixed_args[idx] = fix_assign_value(port(idx), args[idx]);
+
+	// If this function has already been evaluated with these
+	// arguments, then reuse the result.
+      string cache_key;
+      bool use_cache = make_eval_cache_key(fixed_args, cache_key);
+      if (use_cache) {
+	    map<string,NetExpr*>::const_iterator hit = eval_cache_.find(cache_key);
+	    if (hit != eval_cache_.end()) {
+		  if (debug_eval_tree) {
+			cerr << loc.get_fileline() << ": NetFuncDef::evaluate_function: "
+			     << "Reuse cached result of " << scope()->basename()
+			     << ": " << *hit->second << endl;
+		  }
+		  for (size_t idx = 0 ; idx < fixed_args.size() ; idx += 1)
+			delete fixed_args[idx];
+		  return hit->second->dup_expr();
+	    }
+      }
+
 	// Make the context map.
       map<perm_string,LocalVar>::iterator ptr;
       map<perm_string,LocalVar>context_map;
@@ -74,17 +138,16 @@ NetExpr* NetFuncDef::evaluate_function(const LineInfo&loc, const std::vector<Net
       return_var.value  = 0;
 
 	// Load the input ports into the map...
-      ivl_assert(loc, port_count() == args.size());
       for (size_t idx = 0 ; idx < port_count() ; idx += 1) {
 	    const NetNet*pnet = port(idx);
 	    perm_string aname = pnet->name();
 	    LocalVar&input_var = context_map[aname];
 	    input_var.nwords = 0;
-	    input_var.value  = fix_assign_value(pnet, args[idx]);
+	    input_var.value  = fixed_args[idx];
 
 	    if (debug_eval_tree) {
 		  cerr << loc.get_fileline() << ": NetFuncDef::evaluate_function: "
-		       << "   input " << aname << " = " << *args[idx] << endl;
+		       << "   input " << aname << " = " << *fixed_args[idx] << endl;
 	    }
       }
 
@@ -151,6 +214,8 @@ NetExpr* NetFuncDef::evaluate_function(const LineInfo&loc, const std::vector<Net
 		  else cerr << "<nil>";
 		  cerr << endl;
 	    }
+	    if (use_cache && res)
+		  eval_cache_[cache_key] = res->dup_expr();
 	    return res;
       }
 
@@ -2111,6 +2111,9 @@ NetFuncDef::NetFuncDef(NetScope*s, NetNet*result, const vector<NetNet*>&po,
 
 NetFuncDef::~NetFuncDef()
 {
+      for (map<string,NetExpr*>::iterator cur = eval_cache_.begin()
+		 ; cur != eval_cache_.end() ; ++cur)
+	    delete cur->second;
 }
 
 const NetNet* NetFuncDef::return_sig() const
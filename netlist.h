@@ -3720,6 +3720,14 @@ class NetFuncDef : public NetBaseDef {
 
     private:
       NetNet*result_sig_;
+
+	// Constant functions have no side effects that survive the
+	// call, so the result depends only on the argument values.
+	// Remember the results of successful evaluations, keyed by
+	// the encoded argument values, so that repeated calls with the
+	// same arguments (very common in parameter calculations) do
+	// not need to walk the function body again.
+      mutable std::map<std::string,NetExpr*> eval_cache_;
 };
 
 /*
@@ -5120,6 +5128,15 @@ class Design {
 	// Iterate over the design...
       void dump(std::ostream&) const;
       void functor(struct functor_t*);
+	// Support for incremental functors. A functor that changes the
+	// netlist can mark the nodes that may now be affected, and a
+	// later functor_marked() applies the functor to only those
+	// nodes instead of rescanning the whole design. Marking a nexus
+	// marks all the nodes connected to it. functor_marked returns
+	// the number of nodes that were visited.
+      void functor_mark(NetNode*);
+      void functor_mark(Nexus*);
+      unsigned functor_marked(struct functor_t*);
       void join_islands(void);
       int emit(struct target_t*) const;
 
@@ -5147,6 +5164,11 @@ class Design {
 	// These are in support of the node functor iterator.
       NetNode*nodes_functor_cur_;
       NetNode*nodes_functor_nxt_;
+	// These are the nodes marked for the incremental functor. The
+	// list keeps the visit order deterministic, and the set holds
+	// the nodes that are still marked (and still exist).
+      std::list<NetNode*>nodes_marked_list_;
+      std::set<NetNode*>nodes_marked_;
 
 	// List the branches in the design.
       NetBranch*branches_;
@@ -25,6 +25,9 @@
 # include  <stdlib.h>
 # include  <sys/types.h>
 # include  <sys/stat.h>
+#ifdef HAVE_STDIO_EXT_H
+# include  <stdio_ext.h>
+#endif
 
 static const char*version_string =
 "Icarus Verilog VVP Code Generator " VERSION " (" VERSION_TAG ")\n\n"
@@ -47,9 +50,13 @@ COPYRIGHT "\n\n"
 FILE*vvp_out = 0;
 int vvp_errors = 0;
 unsigned show_file_line = 0;
+unsigned show_coverage = 0;
 
 int debug_draw = 0;
 
+/* The size of the output buffer for the generated .vvp file. */
+# define VVP_OUT_BUFFER_SIZE (1024*1024)
+
 /* This needs to match the actual flag count in the VVP thread. */
 # define FLAGS_COUNT 512
 
@@ -162,6 +169,8 @@ int target_design(ivl_design_t des)
 	 * printed for procedural statements. (e.g. -pfileline=1).
 	 * The default is no file/line information will be included. */
       const char*fileline = ivl_design_flag(des, "fileline");
+	/* Use -pcoverage=1 to emit statement coverage counters. */
+      const char*coverage = ivl_design_flag(des, "coverage");
 
       const char*debug_flags = ivl_design_flag(des, "debug_flags");
       process_debug_string(debug_flags);
@@ -194,6 +203,9 @@ int target_design(ivl_design_t des)
             show_file_line = fl_value > 0;
       }
 
+      if (strcmp(coverage, "") != 0)
+	    show_coverage = strtol(coverage, 0, 0) > 0;
+
 #ifdef HAVE_FOPEN64
       vvp_out = fopen64(path, "w");
 #else
@@ -204,6 +216,22 @@ int target_design(ivl_design_t des)
 	    return -1;
       }
 
+	/* The code is generated with a great many small fprintf
+	   calls. Give the output a large buffer so that it is written
+	   in big blocks, and since only this thread ever writes the
+	   stream, tell the C library to skip the per-call locking.
+
+	   The fprintf calls themselves are kept. Most of the frequent
+	   ones print net labels with %p, and the same labels are also
+	   built with snprintf in many other places. A private label
+	   formatter would have to replace all of them at once, or the
+	   labels would stop matching where the C library formats %p
+	   differently. */
+      setvbuf(vvp_out, 0, _IOFBF, VVP_OUT_BUFFER_SIZE);
+#ifdef HAVE_STDIO_EXT_H
+      __fsetlocking(vvp_out, FSETLOCKING_BYCALLER);
+#endif
+
       vvp_errors = 0;
 
       draw_execute_header(des);
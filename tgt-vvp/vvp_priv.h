@@ -44,6 +44,12 @@ extern unsigned transient_id;
  */
 extern unsigned show_file_line;
 
+/*
+ * Set to non-zero when the user wants statement coverage counters
+ * (%cov) emitted for procedural statements.
+ */
+extern unsigned show_coverage;
+
 struct vector_info {
       unsigned base;
       unsigned wid;
@@ -381,6 +381,36 @@ void show_stmt_file_line(ivl_statement_t net, const char* desc)
       }
 }
 
+/*
+ * Emit a statement coverage counter when coverage is requested. Blocks
+ * are not counted themselves; the statements they contain are.
+ */
+static void show_stmt_coverage(ivl_statement_t net)
+{
+      unsigned lineno;
+
+      if (!show_coverage) return;
+
+      switch (ivl_statement_type(net)) {
+	  case IVL_ST_BLOCK:
+	  case IVL_ST_FORK:
+	  case IVL_ST_FORK_JOIN_ANY:
+	  case IVL_ST_FORK_JOIN_NONE:
+	  case IVL_ST_NOOP:
+	  case IVL_ST_ALLOC:
+	  case IVL_ST_FREE:
+	    return;
+	  default:
+	    break;
+      }
+
+      lineno = ivl_stmt_lineno(net);
+      if (lineno == 0) return;
+
+      fprintf(vvp_out, "    %%cov %u %u;\n",
+	      ivl_file_table_index(ivl_stmt_file(net)), lineno);
+}
+
 static int show_stmt_alloc(ivl_statement_t net)
 {
       ivl_scope_t scope = ivl_stmt_call(net);
@@ -2312,6 +2342,8 @@ static int show_statement(ivl_statement_t net, ivl_scope_t sscope)
       const ivl_statement_type_t code = ivl_statement_type(net);
       int rc = 0;
 
+      show_stmt_coverage(net);
+
       switch (code) {
 
 	  case IVL_ST_ALLOC:
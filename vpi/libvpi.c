@@ -284,6 +284,11 @@ void vpip_set_return_value(int value)
       assert(vpip_routines);
       vpip_routines->set_return_value(value);
 }
+void vpip_set_fork_test_index(unsigned index)
+{
+      assert(vpip_routines);
+      vpip_routines->set_fork_test_index(index);
+}
 
 DLLEXPORT PLI_UINT32 vpip_set_callback(vpip_routines_s*routines, PLI_UINT32 version)
 {
@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2026 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "sys_priv.h"
+# include  <assert.h>
+# include  <stdio.h>
+# include  <stdlib.h>
+# include  <string.h>
+
+/*
+ * $save_state(<file>) writes the values of all the static variables
+ * and memories in the design to a binary file, and
+ * $restore_state(<file>) writes them back. This lets a test save the
+ * design state after a long reset or boot sequence and have later
+ * runs of the same design start from there:
+ *
+ *     initial if ($test$plusargs("warm")) $restore_state("boot.state");
+ *
+ * Only variable values are saved. Nets are recomputed from their
+ * drivers, and the scheduler queues and threads are not part of the
+ * file. The design must be quiet when it is saved, with no pending
+ * events the restored run depends on.
+ *
+ * The file starts with the magic string, then holds one record per
+ * object. A record is a kind byte, the length and text of the full
+ * name, then the value. All numbers are 32bit words in the native
+ * byte order of the machine that wrote the file.
+ */
+
+static const char state_magic[8] = { 'I','V','L','S','T','A','T','1' };
+
+# define STATE_VECTOR 'V'
+# define STATE_REAL   'R'
+# define STATE_MEMORY 'M'
+
+static void put_word(FILE*fp, PLI_UINT32 val)
+{
+      fwrite(&val, sizeof val, 1, fp);
+}
+
+static int get_word(FILE*fp, PLI_UINT32*val)
+{
+      return fread(val, sizeof *val, 1, fp) == 1;
+}
+
+static void put_header(FILE*fp, char kind, vpiHandle item)
+{
+      const char*name = vpi_get_str(vpiFullName, item);
+      PLI_UINT32 len = strlen(name);
+      fputc(kind, fp);
+      put_word(fp, len);
+      fwrite(name, 1, len, fp);
+}
+
+static void put_vector_value(FILE*fp, vpiHandle item, unsigned wid)
+{
+      s_vpi_value val;
+      unsigned idx;
+
+      val.format = vpiVectorVal;
+      vpi_get_value(item, &val);
+      for (idx = 0 ;  idx < (wid+31)/32 ;  idx += 1) {
+	    put_word(fp, val.value.vector[idx].aval);
+	    put_word(fp, val.value.vector[idx].bval);
+      }
+}
+
+static unsigned save_item(FILE*fp, vpiHandle item)
+{
+      if (vpi_get(vpiAutomatic, item) == 1)
+	    return 0;
+
+      switch (vpi_get(vpiType, item)) {
+
+	  case vpiRealVar: {
+		s_vpi_value val;
+		val.format = vpiRealVal;
+		vpi_get_value(item, &val);
+		put_header(fp, STATE_REAL, item);
+		fwrite(&val.value.real, sizeof val.value.real, 1, fp);
+		return 1;
+	  }
+
+	  case vpiMemory: {
+		vpiHandle words = vpi_iterate(vpiMemoryWord, item);
+		vpiHandle word = words? vpi_scan(words) : 0;
+		s_vpi_value val;
+		unsigned wid;
+		if (word == 0)
+		      return 0;
+
+		  /* Only arrays of vectors are saved. The natural
+		     format of a word tells what the array holds. */
+		val.format = vpiObjTypeVal;
+		vpi_get_value(word, &val);
+		if (val.format != vpiIntVal) {
+		      vpi_free_object(words);
+		      return 0;
+		}
+
+		wid = vpi_get(vpiSize, word);
+		put_header(fp, STATE_MEMORY, item);
+		put_word(fp, vpi_get(vpiSize, item));
+		put_word(fp, wid);
+		do {
+		      put_vector_value(fp, word, wid);
+		} while ((word = vpi_scan(words)));
+		return 1;
+	  }
+
+	  case vpiStringVar:
+	    return 0;
+
+	  default: {
+		unsigned wid = vpi_get(vpiSize, item);
+		put_header(fp, STATE_VECTOR, item);
+		put_word(fp, wid);
+		put_vector_value(fp, item, wid);
+		return 1;
+	  }
+      }
+}
+
+static unsigned save_items(FILE*fp, vpiHandle scope, int type)
+{
+      vpiHandle iter = vpi_iterate(type, scope);
+      vpiHandle item;
+      unsigned count = 0;
+
+      if (iter == 0)
+	    return 0;
+      while ((item = vpi_scan(iter)))
+	    count += save_item(fp, item);
+
+      return count;
+}
+
+static unsigned save_scope(FILE*fp, vpiHandle scope)
+{
+      vpiHandle iter;
+      vpiHandle child;
+      unsigned count = 0;
+
+      count += save_items(fp, scope, vpiReg);
+      count += save_items(fp, scope, vpiVariables);
+      count += save_items(fp, scope, vpiMemory);
+
+      iter = vpi_iterate(vpiInternalScope, scope);
+      if (iter) while ((child = vpi_scan(iter)))
+	    count += save_scope(fp, child);
+
+      return count;
+}
+
+static PLI_INT32 sys_save_state_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle iter, scope;
+      char*fname;
+      FILE*fp;
+
+      fname = get_filename(callh, name, vpi_scan(argv));
+      vpi_free_object(argv);
+      if (fname == 0)
+	    return 0;
+
+      fp = fopen(fname, "wb");
+      if (fp == 0) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s: Unable to open %s for writing.\n", name, fname);
+	    free(fname);
+	    return 0;
+      }
+
+      fwrite(state_magic, 1, sizeof state_magic, fp);
+
+      iter = vpi_iterate(vpiModule, 0);
+      if (iter) while ((scope = vpi_scan(iter)))
+	    save_scope(fp, scope);
+
+      fclose(fp);
+      free(fname);
+      return 0;
+}
+
+/*
+ * Read the value words of one vector into the vecval buffer. Return
+ * false if the file ends early.
+ */
+static int get_vector_value(FILE*fp, s_vpi_vecval*vec, unsigned wid)
+{
+      unsigned idx;
+      for (idx = 0 ;  idx < (wid+31)/32 ;  idx += 1) {
+	    PLI_UINT32 aval, bval;
+	    if (! get_word(fp, &aval) || ! get_word(fp, &bval))
+		  return 0;
+	    vec[idx].aval = aval;
+	    vec[idx].bval = bval;
+      }
+      return 1;
+}
+
+static void put_vector(vpiHandle item, s_vpi_vecval*vec)
+{
+      s_vpi_value val;
+      val.format = vpiVectorVal;
+      val.value.vector = vec;
+      vpi_put_value(item, &val, 0, vpiNoDelay);
+}
+
+static void mismatch_warning(vpiHandle callh, const char*name,
+			     const char*obj)
+{
+      vpi_printf("WARNING: %s:%d: ", vpi_get_str(vpiFile, callh),
+                 (int)vpi_get(vpiLineNo, callh));
+      vpi_printf("%s: %s does not match an object in this design, "
+                 "skipping it.\n", name, obj);
+}
+
+/*
+ * Restore one record. Return false if the file is malformed. An
+ * object that is missing from the design, or that has changed type
+ * or size, is skipped with a warning.
+ */
+static int restore_record(FILE*fp, int kind, vpiHandle callh,
+			  const char*name)
+{
+      PLI_UINT32 len, wid, cnt, idx;
+      s_vpi_vecval*vec;
+      vpiHandle item;
+      char*obj;
+      int ok = 1;
+
+      if (! get_word(fp, &len))
+	    return 0;
+      obj = malloc(len+1);
+      if (fread(obj, 1, len, fp) != len) {
+	    free(obj);
+	    return 0;
+      }
+      obj[len] = 0;
+
+      item = vpi_handle_by_name(obj, 0);
+
+      switch (kind) {
+
+	  case STATE_REAL: {
+		s_vpi_value val;
+		if (fread(&val.value.real, sizeof val.value.real, 1, fp) != 1) {
+		      ok = 0;
+		      break;
+		}
+		if (item == 0 || vpi_get(vpiType, item) != vpiRealVar) {
+		      mismatch_warning(callh, name, obj);
+		      break;
+		}
+		val.format = vpiRealVal;
+		vpi_put_value(item, &val, 0, vpiNoDelay);
+		break;
+	  }
+
+	  case STATE_VECTOR:
+	    if (! get_word(fp, &wid)) {
+		  ok = 0;
+		  break;
+	    }
+	    vec = calloc((wid+31)/32, sizeof(s_vpi_vecval));
+	    ok = get_vector_value(fp, vec, wid);
+	    if (ok) {
+		  if (item == 0 || vpi_get(vpiType, item) == vpiMemory
+		      || (PLI_UINT32)vpi_get(vpiSize, item) != wid)
+			mismatch_warning(callh, name, obj);
+		  else
+			put_vector(item, vec);
+	    }
+	    free(vec);
+	    break;
+
+	  case STATE_MEMORY: {
+		vpiHandle words = 0;
+		if (! get_word(fp, &cnt) || ! get_word(fp, &wid)) {
+		      ok = 0;
+		      break;
+		}
+		if (item && vpi_get(vpiType, item) == vpiMemory
+		    && (PLI_UINT32)vpi_get(vpiSize, item) == cnt)
+		      words = vpi_iterate(vpiMemoryWord, item);
+		if (words == 0)
+		      mismatch_warning(callh, name, obj);
+
+		vec = calloc((wid+31)/32, sizeof(s_vpi_vecval));
+		for (idx = 0 ;  ok && idx < cnt ;  idx += 1) {
+		      vpiHandle word = words? vpi_scan(words) : 0;
+		      ok = get_vector_value(fp, vec, wid);
+		      if (word == 0) {
+			    words = 0;
+			    continue;
+		      }
+		      if (ok && (PLI_UINT32)vpi_get(vpiSize, word) == wid)
+			    put_vector(word, vec);
+		}
+		if (words) vpi_free_object(words);
+		free(vec);
+		break;
+	  }
+
+	  default:
+	    ok = 0;
+	    break;
+      }
+
+      free(obj);
+      return ok;
+}
+
+static PLI_INT32 sys_restore_state_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      char magic[sizeof state_magic];
+      char*fname;
+      FILE*fp;
+      int kind;
+
+      fname = get_filename(callh, name, vpi_scan(argv));
+      vpi_free_object(argv);
+      if (fname == 0)
+	    return 0;
+
+      fp = fopen(fname, "rb");
+      if (fp == 0) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s: Unable to open %s for reading.\n", name, fname);
+	    free(fname);
+	    return 0;
+      }
+
+      if (fread(magic, 1, sizeof magic, fp) != sizeof magic
+	  || memcmp(magic, state_magic, sizeof magic) != 0) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s: %s is not a saved state file.\n", name, fname);
+	    fclose(fp);
+	    free(fname);
+	    return 0;
+      }
+
+      while ((kind = fgetc(fp)) != EOF) {
+	    if (! restore_record(fp, kind, callh, name)) {
+		  vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+		             (int)vpi_get(vpiLineNo, callh));
+		  vpi_printf("%s: %s is truncated or corrupt.\n",
+		             name, fname);
+		  break;
+	    }
+      }
+
+      fclose(fp);
+      free(fname);
+      return 0;
+}
+
+void sys_checkpoint_register(void)
+{
+      s_vpi_systf_data tf_data;
+      vpiHandle res;
+
+      tf_data.type      = vpiSysTask;
+      tf_data.tfname    = "$save_state";
+      tf_data.calltf    = sys_save_state_calltf;
+      tf_data.compiletf = sys_one_string_arg_compiletf;
+      tf_data.sizetf    = 0;
+      tf_data.user_data = "$save_state";
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+
+      tf_data.type      = vpiSysTask;
+      tf_data.tfname    = "$restore_state";
+      tf_data.calltf    = sys_restore_state_calltf;
+      tf_data.compiletf = sys_one_string_arg_compiletf;
+      tf_data.sizetf    = 0;
+      tf_data.user_data = "$restore_state";
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+}
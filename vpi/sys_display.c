@@ -1276,27 +1276,70 @@ static PLI_INT32 sys_display_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
       return sys_common_compiletf(name, 0, 0);
 }
 
+/*
+ * The argument handles, file and line of a $display style call do not
+ * change from one call to the next, so they are collected the first
+ * time the call runs and kept with the call handle. The file
+ * descriptor argument (if any) is kept separately and evaluated on
+ * every call. All of them are kept on a list so that they can be
+ * released at the end of simulation.
+ */
+struct display_call_info {
+      struct strobe_cb_info info;
+      vpiHandle fd;
+      struct display_call_info*next;
+};
+
+static struct display_call_info*display_call_list = 0;
+
+static struct display_call_info*get_display_call_info(vpiHandle callh,
+						      const char*name)
+{
+      struct display_call_info*call;
+      vpiHandle argv, scope;
+
+      call = (struct display_call_info*)vpi_get_userdata(callh);
+      if (call) return call;
+
+      call = calloc(1, sizeof(struct display_call_info));
+      argv = vpi_iterate(vpiArgument, callh);
+      if (name[1] == 'f') call->fd = vpi_scan(argv);
+
+      scope = vpi_handle(vpiScope, callh);
+      assert(scope);
+	/* We could use vpi_get_str(vpiName, callh) to get the task name,
+	 * but name is already defined. */
+      call->info.name = name;
+      call->info.filename = strdup(vpi_get_str(vpiFile, callh));
+      call->info.lineno = (int)vpi_get(vpiLineNo, callh);
+      call->info.default_format = get_default_format(name);
+      call->info.scope = scope;
+      array_from_iterator(&call->info, argv);
+
+      call->next = display_call_list;
+      display_call_list = call;
+      vpi_put_userdata(callh, call);
+      return call;
+}
+
 /* This implements the $sformatf, $display/$fdisplay
  * and the $write/$fwrite based tasks. */
 static PLI_INT32 sys_display_calltf(ICARUS_VPI_CONST PLI_BYTE8 *name)
 {
-      vpiHandle callh, argv, scope;
-      struct strobe_cb_info info;
+      vpiHandle callh;
+      struct display_call_info*call;
       char* result;
       unsigned int size;
       PLI_UINT32 fd_mcd;
       s_vpi_value val;
 
       callh = vpi_handle(vpiSysTfCall, 0);
-      argv = vpi_iterate(vpiArgument, callh);
+      call = get_display_call_info(callh, name);
 
 	/* Get the file/MC descriptor and verify it is valid. */
       if (name[1] == 'f') {
-	    vpiHandle fd = vpi_scan(argv);
-	    if (get_fd_mcd_from_arg(&fd_mcd, fd, callh, name)) {
-		  vpi_free_object(argv);
+	    if (get_fd_mcd_from_arg(&fd_mcd, call->fd, callh, name))
 		  return 0;
-	    }
       } else if (strncmp(name, "$sformatf", 9) == 0) {
 	      /* return as a string */
 	    fd_mcd = 0;
@@ -1305,25 +1348,19 @@ static PLI_INT32 sys_display_calltf(ICARUS_VPI_CONST PLI_BYTE8 *name)
 	    fd_mcd = 1;
       }
 
-      scope = vpi_handle(vpiScope, callh);
-      assert(scope);
-	/* We could use vpi_get_str(vpiName, callh) to get the task name,
-	 * but name is already defined. */
-      info.name = name;
-      info.filename = strdup(vpi_get_str(vpiFile, callh));
-      info.lineno = (int)vpi_get(vpiLineNo, callh);
-      info.default_format = get_default_format(name);
-      info.scope = scope;
-      array_from_iterator(&info, argv);
-
 	/* Because %u and %z may put embedded NULL characters into the
 	 * returned string strlen() may not match the real size! */
-      result = get_display(&size, &info);
+      result = get_display(&size, &call->info);
 
       if (fd_mcd > 0) {
-	     my_mcd_rawwrite(fd_mcd, result, size);
 	     if ((strncmp(name,"$display",8) == 0) ||
-	         (strncmp(name,"$fdisplay",9) == 0)) my_mcd_rawwrite(fd_mcd, "\n", 1);
+	         (strncmp(name,"$fdisplay",9) == 0)) {
+		     /* The result has room for a trailing NULL, so
+		      * the newline can go out in the same write. */
+		   result[size] = '\n';
+		   size += 1;
+	     }
+	     my_mcd_rawwrite(fd_mcd, result, size);
       } else {
 	       /* Return as a string ($sformatf) */
 	     val.format = vpiStringVal;
@@ -1332,8 +1369,6 @@ static PLI_INT32 sys_display_calltf(ICARUS_VPI_CONST PLI_BYTE8 *name)
       }
 
       free(result);
-      free(info.filename);
-      free(info.items);
       return 0;
 }
 
@@ -2192,6 +2227,14 @@ static PLI_INT32 sys_end_of_simulation(p_cb_data cb_data)
 
       free(timeformat_info.suff);
       timeformat_info.suff = 0;
+
+      while (display_call_list) {
+	    struct display_call_info*call = display_call_list;
+	    display_call_list = call->next;
+	    free(call->info.filename);
+	    free(call->info.items);
+	    free(call);
+      }
       return 0;
 }
 
@@ -21,6 +21,30 @@
 # include  <string.h>
 # include  <stdlib.h>
 # include  <assert.h>
+# include  <stdio.h>
+#ifndef __MINGW32__
+# include  <errno.h>
+# include  <sys/types.h>
+# include  <sys/wait.h>
+# include  <unistd.h>
+#endif
+
+/*
+ * A process started by $fork_tests sees its own +args in front of the
+ * ones given on the command line. This is the argument list that the
+ * plusargs functions search in that case.
+ */
+static int fork_argc = 0;
+static char**fork_argv = 0;
+
+static void get_plusargs_info(s_vpi_vlog_info*info)
+{
+      vpi_get_vlog_info(info);
+      if (fork_argv) {
+	    info->argc = fork_argc;
+	    info->argv = fork_argv;
+      }
+}
 
 /*
  * Compare the +arguments passed to the simulator with the argument
@@ -44,7 +68,7 @@ static PLI_INT32 sys_test_plusargs_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       vpi_get_value(vpi_scan(argv), &val);
       slen = strlen(val.value.str);
 
-      vpi_get_vlog_info(&info);
+      get_plusargs_info(&info);
 
 	/* Look for a +arg that matches the prefix supplied. */
       for (idx = 0 ;  idx < info.argc ;  idx += 1) {
@@ -226,7 +250,7 @@ static PLI_INT32 sys_value_plusargs_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	    *(cp+1) = '\0';
       }
 
-      vpi_get_vlog_info(&info);
+      get_plusargs_info(&info);
 
 	/* Look for a +arg that matches the prefix supplied. */
       for (idx = 0 ;  idx < info.argc ;  idx += 1) {
@@ -390,6 +414,276 @@ static PLI_INT32 sys_value_plusargs_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       return 0;
 }
 
+static PLI_INT32 sys_fork_tests_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle arg;
+
+	/* Check that there is a file name argument. */
+      if (argv == 0 || ! is_string_obj(vpi_scan(argv))) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s's first argument must be a file name (string).\n",
+	               name);
+	    vpip_set_return_value(1);
+	    vpi_control(vpiFinish, 1);
+	    return 0;
+      }
+
+	/* The job limit is optional. */
+      arg = vpi_scan(argv);
+      if (arg == 0) return 0;
+      if (! is_numeric_obj(arg)) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s's second argument (job limit) must be numeric.\n",
+	               name);
+	    vpip_set_return_value(1);
+	    vpi_control(vpiFinish, 1);
+      }
+
+      check_for_extra_args(argv, callh, name, "two arguments", 1);
+      return 0;
+}
+
+#ifndef __MINGW32__
+static void free_fork_tests(char***tests)
+{
+      unsigned idx, arg;
+
+      if (tests == 0) return;
+      for (idx = 0 ;  tests[idx] ;  idx += 1) {
+	    for (arg = 0 ;  tests[idx][arg] ;  arg += 1)
+		  free(tests[idx][arg]);
+	    free(tests[idx]);
+      }
+      free(tests);
+}
+
+/*
+ * Read the tests file. Each line that is not blank or a # comment
+ * describes one test as the +args to give it. The list is returned as
+ * a NULL terminated array of NULL terminated argument arrays. A line
+ * that does not fit in the line buffer is not split into two tests;
+ * instead its line number is returned in *long_line and the result
+ * is NULL.
+ */
+static char***read_fork_tests(FILE*fp, unsigned*count, unsigned*long_line)
+{
+      char line[4096];
+      char***tests = 0;
+      unsigned ntests = 0;
+      unsigned lineno = 0;
+
+      *long_line = 0;
+      while (fgets(line, sizeof line, fp)) {
+	    char**args = 0;
+	    unsigned nargs = 0;
+	    char*tok;
+
+	    lineno += 1;
+	    if (strchr(line, '\n') == 0 && ! feof(fp)) {
+		  int ch = getc(fp);
+		  if (ch != '\n' && ch != EOF) {
+			if (tests) tests[ntests] = 0;
+			free_fork_tests(tests);
+			*long_line = lineno;
+			*count = 0;
+			return 0;
+		  }
+	    }
+
+	    for (tok = strtok(line, " \t\r\n") ; tok ; tok = strtok(0, " \t\r\n")) {
+		  if (nargs == 0 && tok[0] == '#')
+			break;
+		  args = realloc(args, (nargs+2)*sizeof(char*));
+		  args[nargs++] = strdup(tok);
+	    }
+	    if (nargs == 0)
+		  continue;
+	    args[nargs] = 0;
+
+	    tests = realloc(tests, (ntests+2)*sizeof(char**));
+	    tests[ntests++] = args;
+      }
+
+      if (tests) tests[ntests] = 0;
+      *count = ntests;
+      return tests;
+}
+
+/*
+ * In the child process, put the test's +args in front of the command
+ * line arguments so that they are found first. They are followed by
+ * a +fork_test_index=<n> argument (counting from 1) that the test can
+ * use to name its own output files. The index is also passed to the
+ * run time, which gives the coverage database of each test a ".<n>"
+ * suffix.
+ */
+static void set_fork_args(char**args, unsigned index)
+{
+      s_vpi_vlog_info info;
+      char buf[64];
+      int nargs = 0, idx;
+
+      vpi_get_vlog_info(&info);
+      while (args[nargs]) nargs += 1;
+
+      fork_argc = nargs + 1 + info.argc;
+      fork_argv = malloc((fork_argc+1)*sizeof(char*));
+      for (idx = 0 ;  idx < nargs ;  idx += 1)
+	    fork_argv[idx] = args[idx];
+      snprintf(buf, sizeof buf, "+fork_test_index=%u", index);
+      fork_argv[nargs] = strdup(buf);
+      for (idx = 0 ;  idx < info.argc ;  idx += 1)
+	    fork_argv[nargs+1+idx] = info.argv[idx];
+      fork_argv[fork_argc] = 0;
+
+      vpip_set_fork_test_index(index);
+}
+
+/*
+ * Wait for one test to finish and count it if it failed. Return 0 if
+ * there is no child left to wait for.
+ */
+static int wait_for_fork_test(unsigned*failed)
+{
+      int status;
+
+      while (wait(&status) < 0) {
+	    if (errno != EINTR)
+		  return 0;
+      }
+      if (! WIFEXITED(status) || WEXITSTATUS(status) != 0)
+	    *failed += 1;
+      return 1;
+}
+#endif
+
+/*
+ * $fork_tests(<file> [, <jobs>]) splits the simulation into one
+ * process per test listed in the file. Each child process continues
+ * the simulation from the point of the call with the test's +args
+ * added to the ones that $test$plusargs and $value$plusargs see. The
+ * parent waits for the children, running at most <jobs> of them at a
+ * time, then exits. The exit status is nonzero if any child failed.
+ *
+ * The children inherit everything the parent has open: stdout, the
+ * log file, files opened with $fopen and any waveform dump all stay
+ * shared, so their output interleaves. A test that writes files of
+ * its own should name them with $value$plusargs("fork_test_index=%d")
+ * and open them after the fork. Only the coverage database is kept
+ * apart by vvp itself.
+ */
+static PLI_INT32 sys_fork_tests_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+#ifdef __MINGW32__
+      vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+                 (int)vpi_get(vpiLineNo, callh));
+      vpi_printf("%s is not supported on this platform.\n", name);
+      return 0;
+#else
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle jobs_arg;
+      char*fname;
+      char***tests;
+      FILE*fp;
+      unsigned ntests, idx, running = 0, failed = 0, long_line;
+      unsigned max_jobs = 0;
+      s_vpi_value val;
+
+      fname = get_filename(callh, name, vpi_scan(argv));
+      if (fname == 0) {
+	    vpi_free_object(argv);
+	    return 0;
+      }
+
+      jobs_arg = vpi_scan(argv);
+      if (jobs_arg) {
+	    val.format = vpiIntVal;
+	    vpi_get_value(jobs_arg, &val);
+	    if (val.value.integer > 0) max_jobs = val.value.integer;
+	    vpi_free_object(argv);
+      }
+
+      fp = fopen(fname, "r");
+      if (fp == 0) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s: Unable to open %s for reading.\n", name, fname);
+	    free(fname);
+	    return 0;
+      }
+      tests = read_fork_tests(fp, &ntests, &long_line);
+      fclose(fp);
+      if (long_line) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s: %s:%u: Test line is too long.\n",
+	               name, fname, long_line);
+	    free(fname);
+	    return 0;
+      }
+      if (ntests == 0) {
+	    vpi_printf("WARNING: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s: %s lists no tests.\n", name, fname);
+	    free(fname);
+	    return 0;
+      }
+      if (max_jobs == 0) max_jobs = ntests;
+
+	/* Flush any pending output so that it is not written again
+	   by every child. */
+      vpi_mcd_flush(0xffffffff);
+      fflush(0);
+
+      for (idx = 0 ;  idx < ntests ;  idx += 1) {
+	    pid_t pid;
+
+	    if (running == max_jobs) {
+		    /* If no child is left the count is stale. */
+		  if (wait_for_fork_test(&failed))
+			running -= 1;
+		  else
+			running = 0;
+	    }
+
+	    pid = fork();
+	    if (pid == 0) {
+		    /* This is the child. It keeps the args of its
+		       own test and carries on with the simulation. */
+		  set_fork_args(tests[idx], idx+1);
+		  free(fname);
+		  return 0;
+	    }
+
+	    if (pid < 0) {
+		  vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+		             (int)vpi_get(vpiLineNo, callh));
+		  vpi_printf("%s: Unable to start test %u.\n", name, idx+1);
+		  failed += 1;
+		  continue;
+	    }
+	    running += 1;
+      }
+
+      while (running > 0) {
+	    if (! wait_for_fork_test(&failed))
+		  break;
+	    running -= 1;
+      }
+
+      vpi_printf("%s: %u of %u tests from %s failed.\n",
+                 name, failed, ntests, fname);
+      vpi_mcd_flush(0xffffffff);
+      fflush(0);
+      exit(failed ? 1 : 0);
+#endif
+}
+
 void sys_plusargs_register(void)
 {
       s_vpi_systf_data tf_data;
@@ -415,4 +709,13 @@ void sys_plusargs_register(void)
       res = vpi_register_systf(&tf_data);
       vpip_make_systf_system_defined(res);
 
+      tf_data.type        = vpiSysTask;
+      tf_data.tfname      = "$fork_tests";
+      tf_data.calltf      = sys_fork_tests_calltf;
+      tf_data.compiletf   = sys_fork_tests_compiletf;
+      tf_data.sizetf      = 0;
+      tf_data.user_data   = "$fork_tests";
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+
 }
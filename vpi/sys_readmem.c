@@ -269,6 +269,28 @@ static PLI_INT32 sys_mem_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
       return 0;
 }
 
+/*
+ * Open a memory file for reading, looking through the $readmempath
+ * directories if the file is not found as given.
+ */
+static FILE* open_readmem_file(const char*fname, const char*mode)
+{
+      FILE*file = fopen(fname, mode);
+	/* Check to see if we have other directories to look for this file. */
+      if (file == 0 && sl_count > 0 && fname[0] != '/') {
+	    unsigned idx;
+	    char path[4096];
+
+	    for (idx = 0; idx < sl_count; idx += 1) {
+		  snprintf(path, sizeof(path), "%s/%s",
+		           search_list[idx], fname);
+		  path[sizeof(path)-1] = 0;
+		  if ((file = fopen(path, mode))) break;
+	    }
+      }
+      return file;
+}
+
 static PLI_INT32 sys_readmem_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
       int code, wwid, addr;
@@ -310,19 +332,7 @@ static PLI_INT32 sys_readmem_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       }
 
 	/* Open the data file. */
-      file = fopen(fname, "r");
-	/* Check to see if we have other directories to look for this file. */
-      if (file == 0 && sl_count > 0 && fname[0] != '/') {
-	    unsigned idx;
-	    char path[4096];
-
-	    for (idx = 0; idx < sl_count; idx += 1) {
-		  snprintf(path, sizeof(path), "%s/%s",
-		           search_list[idx], fname);
-		  path[sizeof(path)-1] = 0;
-		  if ((file = fopen(path, "r"))) break;
-	    }
-      }
+      file = open_readmem_file(fname, "r");
       if (file == 0) {
 	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
 	               (int)vpi_get(vpiLineNo, callh));
@@ -584,6 +594,192 @@ static PLI_INT32 sys_writemem_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       return 0;
 }
 
+/*
+ * The raw memory files have no text at all. Each word is stored as
+ * (width+7)/8 bytes, least significant byte first, so firmware
+ * binary images can be loaded directly. The "4" variants store the
+ * aval bytes of each word followed by its bval bytes, which keeps the
+ * x and z bits. The plain variants write x and z bits as 0.
+ */
+static PLI_INT32 sys_readmemraw_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      int addr, wwid;
+      FILE*file;
+      char*fname = 0;
+      s_vpi_value value;
+      unsigned char*buf;
+      unsigned nbytes, nwords, idx, cnt, word_count;
+      int four_state = strcmp(name, "$readmemraw4") == 0;
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle mitem = 0;
+      vpiHandle start_item = 0;
+      vpiHandle stop_item = 0;
+
+      int start_addr, stop_addr, addr_incr;
+      int min_addr, max_addr;
+
+      /*======================================== Get parameters */
+
+      get_mem_params(argv, callh, name,
+                     &fname, &mitem, &start_item, &stop_item);
+      if (fname == 0) return 0;
+
+      /*======================================== Process parameters */
+
+      if (process_params(mitem, start_item, stop_item, callh, name,
+                         &start_addr, &stop_addr, &addr_incr,
+                         &min_addr, &max_addr)) {
+	    free(fname);
+	    return 0;
+      }
+
+      file = open_readmem_file(fname, "rb");
+      if (file == 0) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s: Unable to open %s for reading.\n", name, fname);
+	    free(fname);
+	    return 0;
+      }
+
+      word_count = max_addr-min_addr+1;
+      wwid = vpi_get(vpiSize, vpi_handle_by_index(mitem, min_addr));
+      nbytes = (wwid+7)/8;
+      nwords = (wwid+31)/32;
+
+      value.format = vpiVectorVal;
+      value.value.vector = calloc(nwords, sizeof(s_vpi_vecval));
+      buf = malloc(four_state? 2*nbytes : nbytes);
+
+      /*======================================== Read memory file */
+
+      for (addr = start_addr, cnt = 0 ;  cnt < word_count ;
+	   addr += addr_incr, cnt += 1) {
+	    vpiHandle word_index;
+
+	    if (fread(buf, 1, four_state? 2*nbytes : nbytes, file)
+		!= (four_state? 2*nbytes : nbytes))
+		  break;
+
+	    for (idx = 0 ;  idx < nwords ;  idx += 1) {
+		  value.value.vector[idx].aval = 0;
+		  value.value.vector[idx].bval = 0;
+	    }
+	    for (idx = 0 ;  idx < nbytes ;  idx += 1) {
+		  unsigned shift = 8 * (idx%4);
+		  value.value.vector[idx/4].aval |= (PLI_UINT32)buf[idx] << shift;
+		  if (four_state)
+			value.value.vector[idx/4].bval |=
+			      (PLI_UINT32)buf[nbytes+idx] << shift;
+	    }
+
+	    word_index = vpi_handle_by_index(mitem, addr);
+	    assert(word_index);
+	    vpi_put_value(word_index, &value, 0, vpiNoDelay);
+      }
+
+	/* Print a warning if the file did not exactly fill the
+	   requested range. A partial word at the end is counted as
+	   a missing word. */
+      if (cnt < word_count) {
+	    vpi_printf("WARNING: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s(%s): Not enough words in the file for the "
+		       "requested range [%d:%d].\n", name, fname,
+		       start_addr, stop_addr);
+      } else if (fgetc(file) != EOF) {
+	    vpi_printf("WARNING: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s(%s): Too many words in the file for the "
+		       "requested range [%d:%d].\n", name, fname,
+		       start_addr, stop_addr);
+      }
+
+      free(buf);
+      free(value.value.vector);
+      free(fname);
+      fclose(file);
+      return 0;
+}
+
+static PLI_INT32 sys_writememraw_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      int addr, wwid;
+      FILE*file;
+      char*fname = 0;
+      s_vpi_value value;
+      unsigned char*buf;
+      unsigned nbytes, idx;
+      int four_state = strcmp(name, "$writememraw4") == 0;
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle mitem = 0;
+      vpiHandle start_item = 0;
+      vpiHandle stop_item = 0;
+
+      int start_addr, stop_addr, addr_incr;
+      int min_addr, max_addr;
+
+      /*======================================== Get parameters */
+
+      get_mem_params(argv, callh, name,
+                     &fname, &mitem, &start_item, &stop_item);
+      if (fname == 0) return 0;
+
+      /*======================================== Process parameters */
+
+      if (process_params(mitem, start_item, stop_item, callh, name,
+                         &start_addr, &stop_addr, &addr_incr,
+                         &min_addr, &max_addr)) {
+	    free(fname);
+	    return 0;
+      }
+
+      file = fopen(fname, "wb");
+      if (file == 0) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s: Unable to open %s for writing.\n", name, fname);
+	    free(fname);
+	    return 0;
+      }
+
+      wwid = vpi_get(vpiSize, vpi_handle_by_index(mitem, min_addr));
+      nbytes = (wwid+7)/8;
+      buf = malloc(four_state? 2*nbytes : nbytes);
+      value.format = vpiVectorVal;
+
+      /*======================================== Write memory file */
+
+      for (addr = start_addr ;  addr != stop_addr+addr_incr ;
+	   addr += addr_incr) {
+	    vpiHandle word_index;
+
+	    word_index = vpi_handle_by_index(mitem, addr);
+	    assert(word_index);
+	    vpi_get_value(word_index, &value);
+
+	    for (idx = 0 ;  idx < nbytes ;  idx += 1) {
+		  unsigned shift = 8 * (idx%4);
+		  PLI_UINT32 aval = value.value.vector[idx/4].aval;
+		  PLI_UINT32 bval = value.value.vector[idx/4].bval;
+		  if (four_state) {
+			buf[idx] = aval >> shift;
+			buf[nbytes+idx] = bval >> shift;
+		  } else {
+			buf[idx] = (aval & ~bval) >> shift;
+		  }
+	    }
+	    fwrite(buf, 1, four_state? 2*nbytes : nbytes, file);
+      }
+
+      free(buf);
+      fclose(file);
+      free(fname);
+      return 0;
+}
+
 void sys_readmem_register(void)
 {
       s_vpi_systf_data tf_data;
@@ -635,6 +831,42 @@ void sys_readmem_register(void)
       res = vpi_register_systf(&tf_data);
       vpip_make_systf_system_defined(res);
 
+      tf_data.type      = vpiSysTask;
+      tf_data.tfname    = "$readmemraw";
+      tf_data.calltf    = sys_readmemraw_calltf;
+      tf_data.compiletf = sys_mem_compiletf;
+      tf_data.sizetf    = 0;
+      tf_data.user_data = "$readmemraw";
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+
+      tf_data.type      = vpiSysTask;
+      tf_data.tfname    = "$readmemraw4";
+      tf_data.calltf    = sys_readmemraw_calltf;
+      tf_data.compiletf = sys_mem_compiletf;
+      tf_data.sizetf    = 0;
+      tf_data.user_data = "$readmemraw4";
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+
+      tf_data.type      = vpiSysTask;
+      tf_data.tfname    = "$writememraw";
+      tf_data.calltf    = sys_writememraw_calltf;
+      tf_data.compiletf = sys_mem_compiletf;
+      tf_data.sizetf    = 0;
+      tf_data.user_data = "$writememraw";
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+
+      tf_data.type      = vpiSysTask;
+      tf_data.tfname    = "$writememraw4";
+      tf_data.calltf    = sys_writememraw_calltf;
+      tf_data.compiletf = sys_mem_compiletf;
+      tf_data.sizetf    = 0;
+      tf_data.user_data = "$writememraw4";
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+
       cb_data.reason = cbEndOfSimulation;
       cb_data.time = 0;
       cb_data.cb_rtn = free_readmempath;
@@ -37,8 +37,26 @@ static vpiHandle sdf_callh = 0;
   /* The cell in process. */
 static vpiHandle sdf_cur_cell;
 
+  /* The hierarchical part of the last cellinst name, and the scope
+     it resolved to. Consecutive cells are usually siblings, so this
+     saves walking the same path again for each of them. */
+static char*sdf_last_path = 0;
+static vpiHandle sdf_last_path_scope = 0;
+
 static vpiHandle find_scope(vpiHandle scope, const char*name)
 {
+	/* The run time keeps a name index for each module, so use that
+	 * when we can. The lookup can also return an item that is not a
+	 * module, or the scope itself, and those do not count. Names
+	 * with escapes or dots would be taken apart as paths, so they
+	 * are matched the long way. */
+      if (strpbrk(name, "\\.") == 0 && vpi_get(vpiType, scope) == vpiModule) {
+	    vpiHandle cur = vpi_handle_by_name(name, scope);
+	    if (cur && cur != scope && vpi_get(vpiType, cur) == vpiModule)
+		  return cur;
+	    return 0;
+      }
+
       vpiHandle idx = vpi_iterate(vpiModule, scope);
 	/* If this scope has no modules then it can't have the one we
 	 * are looking for so just return 0. */
@@ -66,10 +84,19 @@ void sdf_select_instance(const char*celltype, const char*cellinst)
       char buffer[128];
 
 	/* First follow the hierarchical parts of the cellinst name to
-	   get to the cell that I'm looking for. */
+	   get to the cell that I'm looking for. If they are the same
+	   as for the last cell, start from where that one ended. */
       vpiHandle scope = sdf_scope;
       const char*src = cellinst;
       const char*dp;
+      const char*base = strrchr(cellinst, '.');
+      if (base && sdf_last_path
+	  && strlen(sdf_last_path) == (size_t)(base - cellinst)
+	  && strncmp(sdf_last_path, cellinst, base - cellinst) == 0) {
+	    scope = sdf_last_path_scope;
+	    src = base + 1;
+      }
+
       while ( (dp=strchr(src, '.')) ) {
 	    unsigned len = dp - src;
 	    assert(dp >= src);
@@ -90,6 +117,14 @@ void sdf_select_instance(const char*celltype, const char*cellinst)
 	    scope = tmp_scope;
 
 	    src = dp + 1;
+
+	    if (dp == base) {
+		  free(sdf_last_path);
+		  sdf_last_path = malloc(base - cellinst + 1);
+		  strncpy(sdf_last_path, cellinst, base - cellinst);
+		  sdf_last_path[base - cellinst] = 0;
+		  sdf_last_path_scope = scope;
+	    }
       }
 
 	/* Now find the cell. */
@@ -321,6 +356,10 @@ static PLI_INT32 sys_sdf_annotate_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       sdf_process_file(sdf_fd, fname);
       sdf_callh = 0;
 
+      free(sdf_last_path);
+      sdf_last_path = 0;
+      sdf_last_path_scope = 0;
+
       fclose(sdf_fd);
       free(fname);
       return 0;
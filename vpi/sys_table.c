@@ -23,6 +23,7 @@
 # include <stdlib.h>
 # include <string.h>
 
+extern void sys_checkpoint_register(void);
 extern void sys_convert_register(void);
 extern void sys_countdrivers_register(void);
 extern void sys_darray_register(void);
@@ -196,6 +197,7 @@ static void sys_lxt_or_vcd_register(void)
 }
 
 void (*vlog_startup_routines[])(void) = {
+      sys_checkpoint_register,
       sys_convert_register,
       sys_countdrivers_register,
       sys_darray_register,
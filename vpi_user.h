@@ -640,6 +640,11 @@ extern void vpip_format_strength(char*str, s_vpi_value*value, unsigned bit);
      $finish system tasks bundled with iverilog use this function to
      tell vvp to exit SUCCESS or FAILURE. */
 extern void vpip_set_return_value(int value);
+  /* Tell the vvp run time that this process runs test <index>
+     (counting from 1) of a $fork_tests fan out, so that the output
+     files that vvp writes itself, such as the coverage database, get
+     a ".<index>" suffix. An index of 0 means no forked test. */
+extern void vpip_set_fork_test_index(unsigned index);
 
 extern s_vpi_vecval vpip_calc_clog2(vpiHandle arg);
 extern void vpip_make_systf_system_defined(vpiHandle ref);
@@ -688,7 +693,7 @@ extern void vpip_count_drivers(vpiHandle ref, unsigned idx,
  */
 
 // Increment the version number any time vpip_routines_s is changed.
-static const PLI_UINT32 vpip_routines_version = 1;
+static const PLI_UINT32 vpip_routines_version = 2;
 
 typedef struct {
     vpiHandle   (*register_cb)(p_cb_data);
@@ -729,6 +734,7 @@ typedef struct {
     void        (*make_systf_system_defined)(vpiHandle);
     void        (*mcd_rawwrite)(PLI_UINT32, const char*, size_t);
     void        (*set_return_value)(int);
+    void        (*set_fork_test_index)(unsigned);
 } vpip_routines_s;
 
 extern DLLEXPORT PLI_UINT32 vpip_set_callback(vpip_routines_s*routines, PLI_UINT32 version);
@@ -24,6 +24,7 @@
 # include  "vpi_priv.h"
 # include  "vvp_net_sig.h"
 # include  "vvp_darray.h"
+# include  "vvp_sparse_array.h"
 # include  "config.h"
 #ifdef CHECK_WITH_VALGRIND
 #include  "vvp_cleanup.h"
@@ -44,6 +45,14 @@ unsigned long count_var_arrays = 0;
 unsigned long count_var_array_words = 0;
 unsigned long count_real_arrays = 0;
 unsigned long count_real_array_words = 0;
+unsigned long count_sparse_arrays = 0;
+unsigned long count_sparse_array_words = 0;
+
+/*
+ * Variable arrays with at least this many words are stored sparsely,
+ * with pages of words allocated as they are written.
+ */
+static const unsigned SPARSE_ARRAY_WORDS = 1U << 20;
 
 static symbol_map_s<struct __vpiArray>* array_table =0;
 
@@ -868,7 +877,7 @@ void __vpiArray::attach_word(unsigned addr, vpiHandle word)
 	    fun->attach_as_word(this, addr);
 	    sig->is_netarray = 1;
 	    sig->within.parent = this;
-	    sig->id.index = new __vpiDecConst(addr + first_addr.get_value());
+	    sig->id.index = vpip_shared_dec_const(addr + first_addr.get_value());
 	      // Now we know the data type, update the array signed_flag.
 	    signed_flag = sig->signed_flag;
 	    return;
@@ -882,7 +891,7 @@ void __vpiArray::attach_word(unsigned addr, vpiHandle word)
 	    fun->attach_as_word(this, addr);
 	    sig->is_netarray = 1;
 	    sig->within.parent = this;
-	    sig->id.index = new __vpiDecConst(addr + first_addr.get_value());
+	    sig->id.index = vpip_shared_dec_const(addr + first_addr.get_value());
 	      // Now we know the data type, update the array signed_flag.
 	    signed_flag = true;
 	    return;
@@ -902,6 +911,11 @@ void compile_var_array(char*label, char*name, int last, int first,
       if (vpip_peek_current_scope()->is_automatic()) {
             arr->vals4 = new vvp_vector4array_aa(arr->vals_width,
 						 arr->get_size());
+      } else if (arr->get_size() >= SPARSE_ARRAY_WORDS) {
+            arr->vals4 = new vvp_vector4array_sparse(arr->vals_width,
+						     arr->get_size());
+	    count_sparse_arrays += 1;
+	    count_sparse_array_words += arr->get_size();
       } else {
             arr->vals4 = new vvp_vector4array_sa(arr->vals_width,
 						 arr->get_size());
@@ -1676,17 +1690,10 @@ void memory_delete(vpiHandle item)
 
       if (arr->nets) {
 	    for (unsigned idx = 0; idx < arr->get_size(); idx += 1) {
-		  if (struct __vpiSignal*sig =
-		      dynamic_cast<__vpiSignal*>(arr->nets[idx])) {
-// Delete the individual words?
-			constant_delete(sig->id.index);
 		    /* These should only be the real words. */
-		  } else {
+		  if (dynamic_cast<__vpiSignal*>(arr->nets[idx]) == 0) {
 			assert(arr->nets[idx]->get_type_code() ==
 			       vpiRealVar);
-			struct __vpiRealVar *sigr = (struct __vpiRealVar *)
-			                            arr->nets[idx];
-			constant_delete(sigr->id.index);
 // Why are only the real words still here?
 			delete arr->nets[idx];
 		  }
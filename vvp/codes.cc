@@ -96,6 +96,83 @@ vvp_code_t codespace_null(void)
       return first_chunk + 0;
 }
 
+static bool is_jump(vvp_code_t code)
+{
+      return code->opcode == &of_JMP
+	  || code->opcode == &of_JMP0
+	  || code->opcode == &of_JMP0XZ
+	  || code->opcode == &of_JMP1
+	  || code->opcode == &of_JMP1XZ;
+}
+
+/*
+ * Return true if the jump "src" lands on the instruction "dst" that
+ * is sure to jump again. An unconditional jump (or a chunk link) is
+ * always taken. A conditional jump on the same flag is taken if the
+ * condition that got us there implies its condition, since nothing
+ * has changed the flag in between.
+ */
+static bool jump_continues(vvp_code_t src, vvp_code_t dst)
+{
+      if (dst->opcode == &of_JMP || dst->opcode == &of_CHUNK_LINK)
+	    return true;
+
+      if (src->opcode == &of_JMP)
+	    return false;
+      if (src->bit_idx[0] != dst->bit_idx[0])
+	    return false;
+
+      if (src->opcode == &of_JMP0)
+	    return dst->opcode == &of_JMP0 || dst->opcode == &of_JMP0XZ;
+      if (src->opcode == &of_JMP1)
+	    return dst->opcode == &of_JMP1 || dst->opcode == &of_JMP1XZ;
+
+      return dst->opcode == src->opcode;
+}
+
+unsigned long codespace_thread_jumps(void)
+{
+	/* Limit the length of a followed chain. This also keeps
+	   jump loops (i.e. forever loops that do nothing) from
+	   hanging this function. */
+      const unsigned max_hops = 64;
+      unsigned long count = 0;
+
+      for (vvp_code_t chunk = first_chunk ; chunk
+		 ; chunk = chunk[code_chunk_size-1].cptr) {
+
+	      /* The current chunk is only filled up to the next
+		 free instruction. */
+	    unsigned limit = (chunk == current_chunk)
+		  ? current_within_chunk
+		  : code_chunk_size-1;
+
+	    for (unsigned idx = 0 ; idx < limit ; idx += 1) {
+		  vvp_code_t code = chunk + idx;
+		  if (! is_jump(code))
+			continue;
+
+		  vvp_code_t dst = code->cptr;
+		  unsigned hops = 0;
+		  while (dst && dst->cptr && hops < max_hops
+			 && jump_continues(code, dst)) {
+			dst = dst->cptr;
+			hops += 1;
+		  }
+
+		  if (dst != code->cptr) {
+			code->cptr = dst;
+			count += 1;
+		  }
+	    }
+
+	    if (chunk == current_chunk)
+		  break;
+      }
+
+      return count;
+}
+
 #ifdef CHECK_WITH_VALGRIND
 void codespace_delete(void)
 {
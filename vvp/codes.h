@@ -85,6 +85,7 @@ extern bool of_CONCAT_STR(vthread_t thr, vvp_code_t code);
 extern bool of_CONCATI_STR(vthread_t thr, vvp_code_t code);
 extern bool of_CONCAT_VEC4(vthread_t thr, vvp_code_t code);
 extern bool of_CONCATI_VEC4(vthread_t thr, vvp_code_t code);
+extern bool of_COV(vthread_t thr, vvp_code_t code);
 extern bool of_CVT_RV(vthread_t thr, vvp_code_t code);
 extern bool of_CVT_RV_S(vthread_t thr, vvp_code_t code);
 extern bool of_CVT_SR(vthread_t thr, vvp_code_t code);
@@ -317,4 +318,11 @@ extern vvp_code_t codespace_allocate(void);
 extern vvp_code_t codespace_next(void);
 extern vvp_code_t codespace_null(void);
 
+/*
+ * After all the code labels are resolved, this function shortens
+ * chains of jumps so that each jump goes directly to its final
+ * destination. It returns the number of jumps that were changed.
+ */
+extern unsigned long codespace_thread_jumps(void);
+
 #endif /* IVL_codes_H */
@@ -27,13 +27,19 @@
 # include  "udp.h"
 # include  "symbols.h"
 # include  "codes.h"
+# include  "coverage.h"
 # include  "schedule.h"
 # include  "vpi_priv.h"
 # include  "parse_misc.h"
 # include  "statistics.h"
 # include  "schedule.h"
+# include  "vvp_net_sig.h"
 # include  <iostream>
 # include  <list>
+# include  <map>
+# include  <set>
+# include  <string>
+# include  <typeinfo>
 # include  <cstdlib>
 # include  <cstring>
 # include  <cassert>
@@ -389,7 +395,33 @@ vpiHandle vvp_lookup_handle(const char*label)
       return 0;
 }
 
+/*
+ * These support the BUFZ bypass done by compile_cleanup. The
+ * bufz_driver map records, for each plain BUFZ whose input is linked
+ * to the output of another plain BUFZ, that driver. The pinned_nets
+ * set holds the plain BUFZ nets that are looked up by name for some
+ * purpose other than linking their output to an input port. Those
+ * may be referenced directly (e.g. by %force/link) so must be kept.
+ */
+static std::map<vvp_net_t*,vvp_net_t*> bufz_driver;
+static std::set<vvp_net_t*> pinned_nets;
+
+static bool is_plain_bufz(const vvp_net_t*net)
+{
+      return net->fun && typeid(*net->fun) == typeid(vvp_fun_bufz);
+}
+
+static vvp_net_t* net_lookup_(const char*label);
+
 vvp_net_t* vvp_net_lookup(const char*label)
+{
+      vvp_net_t*net = net_lookup_(label);
+      if (net && is_plain_bufz(net))
+	    pinned_nets.insert(net);
+      return net;
+}
+
+static vvp_net_t* net_lookup_(const char*label)
 {
       static bool t0_trigger_generated = false;
 
@@ -513,11 +545,14 @@ struct vvp_net_resolv_list_s: public resolv_list_s {
 
 bool vvp_net_resolv_list_s::resolve(bool mes)
 {
-      vvp_net_t*tmp = vvp_net_lookup(label());
+      vvp_net_t*tmp = net_lookup_(label());
 
       if (tmp) {
 	      // Link the input port to the located output.
 	    tmp->link(port);
+	    if (port.port() == 0 && is_plain_bufz(port.ptr())
+		&& is_plain_bufz(tmp))
+		  bufz_driver[port.ptr()] = tmp;
 	    return true;
       }
 
@@ -761,6 +796,53 @@ void compile_compiletf(struct __vpiSysTaskCall*obj)
       scheduled_compiletf.push_back(obj);
 }
 
+/*
+ * A plain BUFZ functor that is driven by another plain BUFZ (which
+ * may be the node of a net) only passes along the values that it
+ * receives. Its loads can therefore be moved to the fan-out of its
+ * driver, removing a hop from every value that passes through. The
+ * fan-out order is preserved, so values reach the loads in the same
+ * order as before. Nets that have a filter, nets that are referenced
+ * by name, and drivers that may send strength values are left alone.
+ */
+static unsigned long compile_bypass_bufz(void)
+{
+      unsigned long count = 0;
+
+	// Map bypassed nets to their drivers, so that a BUFZ that was
+	// fed by a bypassed BUFZ can find its actual driver.
+      std::map<vvp_net_t*,vvp_net_t*> bypassed;
+
+      for (std::map<vvp_net_t*,vvp_net_t*>::const_iterator cur = bufz_driver.begin()
+		 ; cur != bufz_driver.end() ; ++ cur ) {
+
+	    vvp_net_t*net = cur->first;
+	    if (net->fil || pinned_nets.count(net))
+		  continue;
+
+	    vvp_net_t*drv = cur->second;
+	    std::map<vvp_net_t*,vvp_net_t*>::const_iterator fwd;
+	    while ((fwd = bypassed.find(drv)) != bypassed.end())
+		  drv = fwd->second;
+
+	    if (drv == net || !is_plain_bufz(drv))
+		  continue;
+	    if (dynamic_cast<vvp_wire_vec8*>(drv->fil))
+		  continue;
+
+	    if (drv->splice_fanout(vvp_net_ptr_t(net,0), net)) {
+		  bypassed[net] = drv;
+		  count += 1;
+	    }
+      }
+
+      bufz_driver.clear();
+      pinned_nets.clear();
+      return count;
+}
+
+static void const_vector4_table_delete(void);
+
 /*
  * When parsing is otherwise complete, this function is called to do
  * the final stuff. Clean up deferred linking here.
@@ -802,6 +884,26 @@ void compile_cleanup(void)
 
       compile_errors += nerrs;
 
+	/* All the code labels are resolved now, so the jump chains
+	   in the thread code can be shortened. */
+      if (compile_errors == 0) {
+	    unsigned long threaded = codespace_thread_jumps();
+	    if (verbose_flag) {
+		  fprintf(stderr, " ... Threaded %lu jumps\n", threaded);
+		  fflush(stderr);
+	    }
+      }
+
+	/* With the net fully linked, remove BUFZ hops that do not
+	   change the values passing through them. */
+      if (compile_errors == 0) {
+	    unsigned long bypassed = compile_bypass_bufz();
+	    if (verbose_flag) {
+		  fprintf(stderr, " ... Bypassed %lu BUFZ nets\n", bypassed);
+		  fflush(stderr);
+	    }
+      }
+
       if (verbose_flag) {
 	    fprintf(stderr, " ... Removing symbol tables\n");
 	    fflush(stderr);
@@ -823,6 +925,9 @@ void compile_cleanup(void)
 
       delete_udp_symbols();
 
+	/* The constants are held by their time zero events now. */
+      const_vector4_table_delete();
+
       compile_island_cleanup();
       compile_array_cleanup();
 
@@ -947,6 +1052,42 @@ double crstring_to_double(const char*label)
  * and skip the symbol lookup.
  */
 
+
+/*
+ * Designs tend to use the same few constants (all zeros, all z, ...)
+ * over and over, and for wide vectors each copy has its own heap
+ * words. So the C4<> strings are parsed once, and every use of the
+ * same string shares the one vector. The table is only needed while
+ * the design is compiled; the vectors live until the last time zero
+ * event that uses them is deleted.
+ */
+static std::map<std::string,const_vector4_s*> const_vector4_table;
+
+const_vector4_s* compile_const_vector4(const char*label)
+{
+      const_vector4_s*&cv = const_vector4_table[label];
+      if (cv == 0) {
+	    cv = new const_vector4_s(c4string_to_vector4(label));
+	    count_const_vectors += 1;
+      }
+      cv->refs += 1;
+      count_const_vector_uses += 1;
+      return cv;
+}
+
+static void const_vector4_table_delete(void)
+{
+      const_vector4_table.clear();
+}
+
+void const_vector4_release(const_vector4_s*cv)
+{
+      assert(cv->refs > 0);
+      cv->refs -= 1;
+      if (cv->refs == 0)
+	    delete cv;
+}
+
 void input_connect(vvp_net_t*fdx, unsigned port, char*label)
 {
       vvp_net_ptr_t ifdx = vvp_net_ptr_t(fdx, port);
@@ -954,7 +1095,7 @@ void input_connect(vvp_net_t*fdx, unsigned port, char*label)
 	/* Is this a vvp_vector4_t constant value? */
       if (c4string_test(label)) {
 
-	    vvp_vector4_t tmp = c4string_to_vector4(label);
+	    const_vector4_s*tmp = compile_const_vector4(label);
 
 	      // Inputs that are constants are schedule to execute as
 	      // soon at the simulation starts. In Verilog, constants
@@ -963,7 +1104,7 @@ void input_connect(vvp_net_t*fdx, unsigned port, char*label)
 	      // scheduler distribute the constant value has the
 	      // additional advantage that the constant is not
 	      // propagated until the network is fully linked.
-	    schedule_set_vector(ifdx, tmp);
+	    schedule_set_const_vector(ifdx, tmp);
 
 	    free(label);
 	    return;
@@ -1915,6 +2056,21 @@ void compile_file_line(char*label, long file_idx, long lineno,
       delete[] description;
 }
 
+void compile_coverage_point(char*label, long file_idx, long lineno)
+{
+      if (label) compile_codelabel(label);
+
+	/* The instruction keeps its own execution count in the number
+	   field, and the file/line of the statement in bit_idx. */
+      vvp_code_t code = codespace_allocate();
+      code->opcode = &of_COV;
+      code->number = 0;
+      code->bit_idx[0] = file_idx;
+      code->bit_idx[1] = lineno;
+
+      coverage_add_point(code);
+}
+
 void compile_vpi_call(char*label, char*name,
                       bool func_as_task_err, bool func_as_task_warn,
                       long file_idx, long lineno,
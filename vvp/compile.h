@@ -61,6 +61,25 @@ extern std::ofstream debug_file;
 extern void inputs_connect(vvp_net_t*fdx, unsigned argc, struct symb_s*argv);
 extern void input_connect(vvp_net_t*fdx, unsigned port, char*label);
 
+/*
+ * An interned C4<...> constant. All uses of the same constant string
+ * share one of these, and each use holds a reference to it. The
+ * vector is deleted when the last reference is released.
+ */
+struct const_vector4_s {
+      explicit const_vector4_s(const vvp_vector4_t&v) : val(v), refs(0) { }
+      vvp_vector4_t val;
+      unsigned long refs;
+};
+
+/*
+ * Return the shared vector for the C4<...> constant string, with a
+ * reference added for the caller. The caller passes the reference on
+ * to the time zero event that drives the constant.
+ */
+extern const_vector4_s* compile_const_vector4(const char*label);
+extern void const_vector4_release(const_vector4_s*cv);
+
 /*
  * This function is an expansion of the inputs_connect function. It
  * uses the inputs_connect function, but it creates vvp_wide_fun_t
@@ -450,6 +469,8 @@ extern void compile_code(char*label, char*mnem, comp_operands_t opa);
 extern void compile_file_line(char*label, long file_idx, long lineno,
                               char*description);
 
+extern void compile_coverage_point(char*label, long file_idx, long lineno);
+
 extern void compile_vpi_call(char*label, char*name,
 			     bool func_as_task_err, bool func_as_task_warn,
 			     long file_idx, long lineno,
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "coverage.h"
+# include  "compile.h"
+# include  <cstdio>
+# include  <cstring>
+# include  <map>
+# include  <vector>
+
+using namespace std;
+
+static vector<vvp_code_t> coverage_points;
+
+void coverage_add_point(vvp_code_t code)
+{
+      coverage_points.push_back(code);
+}
+
+unsigned long coverage_point_count(void)
+{
+      return coverage_points.size();
+}
+
+static void put_u32(FILE*fd, uint32_t val)
+{
+      unsigned char buf[4];
+      for (unsigned idx = 0 ; idx < 4 ; idx += 1)
+	    buf[idx] = val >> (8*idx);
+      fwrite(buf, 1, sizeof buf, fd);
+}
+
+static void put_u64(FILE*fd, uint64_t val)
+{
+      unsigned char buf[8];
+      for (unsigned idx = 0 ; idx < 8 ; idx += 1)
+	    buf[idx] = val >> (8*idx);
+      fwrite(buf, 1, sizeof buf, fd);
+}
+
+bool coverage_write(const char*path)
+{
+	/* Every instance of a module has its own copy of the code, so
+	   sum the counts of the points for the same source line. */
+      typedef pair<uint32_t,uint32_t> line_key_t;
+      map<line_key_t,uint64_t> lines;
+      for (size_t idx = 0 ; idx < coverage_points.size() ; idx += 1) {
+	    vvp_code_t cp = coverage_points[idx];
+	    lines[line_key_t(cp->bit_idx[0], cp->bit_idx[1])] += cp->number;
+      }
+
+	/* Only write the names of the files that have coverage
+	   points, and number them in the order they are written. */
+      map<uint32_t,uint32_t> file_map;
+      for (map<line_key_t,uint64_t>::const_iterator cur = lines.begin()
+		 ; cur != lines.end() ; ++ cur) {
+	    if (file_map.find(cur->first.first) == file_map.end()) {
+		  uint32_t next = file_map.size();
+		  file_map[cur->first.first] = next;
+	    }
+      }
+
+      FILE*fd = fopen(path, "wb");
+      if (fd == 0) {
+	    fprintf(stderr, "Unable to open coverage file %s for writing.\n",
+	            path);
+	    return false;
+      }
+
+      fwrite("IVLCOV1\n", 1, 8, fd);
+
+      put_u32(fd, file_map.size());
+      for (map<uint32_t,uint32_t>::const_iterator cur = file_map.begin()
+		 ; cur != file_map.end() ; ++ cur) {
+	    const char*name = cur->first < file_names.size()
+		  ? file_names[cur->first] : "";
+	    put_u32(fd, strlen(name));
+	    fwrite(name, 1, strlen(name), fd);
+      }
+
+      put_u32(fd, lines.size());
+      for (map<line_key_t,uint64_t>::const_iterator cur = lines.begin()
+		 ; cur != lines.end() ; ++ cur) {
+	    put_u32(fd, file_map[cur->first.first]);
+	    put_u32(fd, cur->first.second);
+	    put_u64(fd, cur->second);
+      }
+
+      fclose(fd);
+      return true;
+}
@@ -0,0 +1,49 @@
+#ifndef IVL_coverage_H
+#define IVL_coverage_H
+/*
+ * Copyright (c) 2026 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "codes.h"
+
+/*
+ * Statement coverage is collected by %cov instructions, which the
+ * code generator places in front of each procedural statement when
+ * the design is compiled with -pcoverage=1. Each instruction counts
+ * its own executions. At the end of the run the counts are summed per
+ * source line and written to a coverage database with this layout,
+ * all numbers little endian:
+ *
+ *     "IVLCOV1\n"
+ *     <u32 file count>   { <u32 length> <name bytes> }...
+ *     <u32 line count>   { <u32 file> <u32 line> <u64 count> }...
+ *
+ * Lines that were compiled but never executed are listed with a
+ * count of zero.
+ */
+
+extern void coverage_add_point(vvp_code_t code);
+
+  /* Return the number of coverage points in the design. */
+extern unsigned long coverage_point_count(void);
+
+  /* Write the database to the given path. Return false and print a
+     message if the file cannot be written. */
+extern bool coverage_write(const char*path);
+
+#endif /* IVL_coverage_H */
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2026 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * vvp_covmerge merges the statement coverage databases written by
+ * vvp (see coverage.h for the format) into a single database with
+ * the counts summed per source line:
+ *
+ *     vvp_covmerge [-j <jobs>] [-l] -o <output> <input>...
+ *
+ * Every input is mapped into memory and checked once. The file names
+ * of all the inputs are then sorted into a global file table. Each
+ * database lists its lines sorted by file and line, so the lines of
+ * any one source file form a sorted run in every input, and the
+ * output for that file is a k-way merge of those runs. The source
+ * files are independent of each other, so they are handed out to a
+ * pool of worker threads. The output does not depend on the number
+ * of threads or on the order in which they finish.
+ *
+ * With -l the merged counts are also listed on stdout as text, one
+ * "<file>:<line>: <count>" line per source line, in database order.
+ */
+
+# include  "config.h"
+# include  <cstdio>
+# include  <cstdlib>
+# include  <cstring>
+# include  <map>
+# include  <string>
+# include  <vector>
+# include  <algorithm>
+# include  <pthread.h>
+# include  <unistd.h>
+# include  <fcntl.h>
+# include  <sys/stat.h>
+#if !defined(__MINGW32__)
+# include  <sys/mman.h>
+#endif
+
+#if defined(HAVE_GETOPT_H)
+# include  <getopt.h>
+#endif
+
+#if defined(__MINGW32__) && !defined(HAVE_GETOPT_H)
+extern "C" int getopt(int argc, char*argv[], const char*fmt);
+extern "C" int optind;
+extern "C" const char*optarg;
+#endif
+
+using namespace std;
+
+static const size_t HEADER_SIZE = 8;
+static const size_t LINE_SIZE = 16;
+
+static uint32_t get_u32(const unsigned char*ptr)
+{
+      return (uint32_t)ptr[0] | ((uint32_t)ptr[1] << 8)
+	    | ((uint32_t)ptr[2] << 16) | ((uint32_t)ptr[3] << 24);
+}
+
+static uint64_t get_u64(const unsigned char*ptr)
+{
+      return (uint64_t)get_u32(ptr) | ((uint64_t)get_u32(ptr+4) << 32);
+}
+
+/*
+ * One input database. The line records are used in place in the
+ * mapped image; file_runs[n] is the range of records for the n'th
+ * file of the global file table, or an empty range.
+ */
+struct cov_input {
+      const char*path;
+      unsigned char*base;
+      size_t size;
+      bool mapped;
+
+      vector<string> names;
+      const unsigned char*lines;
+      uint32_t nlines;
+
+      vector<pair<uint32_t,uint32_t> > file_runs;
+};
+
+static bool load_input(cov_input&in)
+{
+      in.base = 0;
+      in.size = 0;
+      in.mapped = false;
+
+      int fd = open(in.path, O_RDONLY);
+      if (fd < 0) {
+	    fprintf(stderr, "%s: Unable to open for reading.\n", in.path);
+	    return false;
+      }
+
+      struct stat sb;
+      if (fstat(fd, &sb) != 0 || sb.st_size < (off_t)HEADER_SIZE) {
+	    fprintf(stderr, "%s: Not a coverage database.\n", in.path);
+	    close(fd);
+	    return false;
+      }
+      in.size = sb.st_size;
+
+#if !defined(__MINGW32__)
+      void*map = mmap(0, in.size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map != MAP_FAILED) {
+	    in.base = (unsigned char*)map;
+	    in.mapped = true;
+      }
+#endif
+      if (in.base == 0) {
+	    in.base = (unsigned char*)malloc(in.size);
+	    size_t got = 0;
+	    while (got < in.size) {
+		  ssize_t rc = read(fd, in.base+got, in.size-got);
+		  if (rc <= 0) break;
+		  got += rc;
+	    }
+	    if (got != in.size) {
+		  fprintf(stderr, "%s: Read error.\n", in.path);
+		  close(fd);
+		  return false;
+	    }
+      }
+      close(fd);
+
+      if (memcmp(in.base, "IVLCOV1\n", HEADER_SIZE) != 0) {
+	    fprintf(stderr, "%s: Not a coverage database.\n", in.path);
+	    return false;
+      }
+
+      const unsigned char*ptr = in.base + HEADER_SIZE;
+      const unsigned char*end = in.base + in.size;
+
+      if (end - ptr < 4) goto truncated;
+      {
+	    uint32_t nfiles = get_u32(ptr);
+	    ptr += 4;
+	    in.names.reserve(nfiles);
+	    for (uint32_t idx = 0 ; idx < nfiles ; idx += 1) {
+		  if (end - ptr < 4) goto truncated;
+		  uint32_t len = get_u32(ptr);
+		  ptr += 4;
+		  if ((size_t)(end - ptr) < len) goto truncated;
+		  in.names.push_back(string((const char*)ptr, len));
+		  ptr += len;
+	    }
+      }
+
+      if (end - ptr < 4) goto truncated;
+      in.nlines = get_u32(ptr);
+      ptr += 4;
+      if ((size_t)(end - ptr) / LINE_SIZE < in.nlines) goto truncated;
+      in.lines = ptr;
+
+	/* The merge relies on the lines being sorted by file and line,
+	   which is how vvp writes them. Check that here, once, so that
+	   the workers need not. */
+      for (uint32_t idx = 0 ; idx < in.nlines ; idx += 1) {
+	    const unsigned char*rec = in.lines + idx*LINE_SIZE;
+	    if (get_u32(rec) >= in.names.size()) {
+		  fprintf(stderr, "%s: Line record %u has a bad file index.\n",
+			  in.path, idx);
+		  return false;
+	    }
+	    if (idx == 0) continue;
+	    const unsigned char*prev = rec - LINE_SIZE;
+	    uint32_t pfile = get_u32(prev), cfile = get_u32(rec);
+	    if (cfile < pfile || (cfile == pfile
+				   && get_u32(rec+4) <= get_u32(prev+4))) {
+		  fprintf(stderr, "%s: Line records are not sorted.\n",
+			  in.path);
+		  return false;
+	    }
+      }
+      return true;
+
+ truncated:
+      fprintf(stderr, "%s: Truncated coverage database.\n", in.path);
+      return false;
+}
+
+static void unload_input(cov_input&in)
+{
+      if (in.base == 0) return;
+#if !defined(__MINGW32__)
+      if (in.mapped) {
+	    munmap(in.base, in.size);
+	    in.base = 0;
+	    return;
+      }
+#endif
+      free(in.base);
+      in.base = 0;
+}
+
+struct line_count {
+      uint32_t line;
+      uint64_t count;
+};
+
+static vector<cov_input> inputs;
+static vector<string> global_files;
+static vector<vector<line_count> > merged;
+
+static pthread_mutex_t next_file_mutex = PTHREAD_MUTEX_INITIALIZER;
+static size_t next_file = 0;
+
+/*
+ * Merge the runs of all the inputs for a single global file. The run
+ * heads are kept in a min-heap ordered by line number.
+ */
+struct run_head {
+      const unsigned char*cur;
+      const unsigned char*end;
+      bool operator < (const run_head&that) const
+      { return get_u32(cur+4) > get_u32(that.cur+4); }
+};
+
+static void merge_file(size_t file)
+{
+      vector<run_head> heap;
+      size_t total = 0;
+      for (size_t idx = 0 ; idx < inputs.size() ; idx += 1) {
+	    const pair<uint32_t,uint32_t>&run = inputs[idx].file_runs[file];
+	    if (run.first == run.second) continue;
+	    run_head head;
+	    head.cur = inputs[idx].lines + run.first*LINE_SIZE;
+	    head.end = inputs[idx].lines + run.second*LINE_SIZE;
+	    heap.push_back(head);
+	    total += run.second - run.first;
+      }
+
+      vector<line_count>&out = merged[file];
+      out.reserve(total);
+      make_heap(heap.begin(), heap.end());
+      while (! heap.empty()) {
+	    pop_heap(heap.begin(), heap.end());
+	    run_head&head = heap.back();
+	    uint32_t line = get_u32(head.cur+4);
+	    uint64_t count = get_u64(head.cur+8);
+
+	    if (!out.empty() && out.back().line == line) {
+		  out.back().count += count;
+	    } else {
+		  line_count tmp;
+		  tmp.line = line;
+		  tmp.count = count;
+		  out.push_back(tmp);
+	    }
+
+	    head.cur += LINE_SIZE;
+	    if (head.cur == head.end)
+		  heap.pop_back();
+	    else
+		  push_heap(heap.begin(), heap.end());
+      }
+}
+
+static void* merge_worker(void*)
+{
+      for (;;) {
+	    pthread_mutex_lock(&next_file_mutex);
+	    size_t file = next_file++;
+	    pthread_mutex_unlock(&next_file_mutex);
+	    if (file >= global_files.size()) break;
+	    merge_file(file);
+      }
+      return 0;
+}
+
+static void put_u32(FILE*fd, uint32_t val)
+{
+      unsigned char buf[4];
+      for (unsigned idx = 0 ; idx < 4 ; idx += 1)
+	    buf[idx] = val >> (8*idx);
+      fwrite(buf, 1, sizeof buf, fd);
+}
+
+static void put_u64(FILE*fd, uint64_t val)
+{
+      unsigned char buf[8];
+      for (unsigned idx = 0 ; idx < 8 ; idx += 1)
+	    buf[idx] = val >> (8*idx);
+      fwrite(buf, 1, sizeof buf, fd);
+}
+
+static bool write_output(const char*path)
+{
+      FILE*fd = fopen(path, "wb");
+      if (fd == 0) {
+	    fprintf(stderr, "%s: Unable to open for writing.\n", path);
+	    return false;
+      }
+
+      fwrite("IVLCOV1\n", 1, HEADER_SIZE, fd);
+      put_u32(fd, global_files.size());
+      for (size_t idx = 0 ; idx < global_files.size() ; idx += 1) {
+	    put_u32(fd, global_files[idx].size());
+	    fwrite(global_files[idx].data(), 1, global_files[idx].size(), fd);
+      }
+
+      size_t nlines = 0;
+      for (size_t idx = 0 ; idx < merged.size() ; idx += 1)
+	    nlines += merged[idx].size();
+      put_u32(fd, nlines);
+      for (size_t idx = 0 ; idx < merged.size() ; idx += 1) {
+	    const vector<line_count>&cur = merged[idx];
+	    for (size_t ln = 0 ; ln < cur.size() ; ln += 1) {
+		  put_u32(fd, idx);
+		  put_u32(fd, cur[ln].line);
+		  put_u64(fd, cur[ln].count);
+	    }
+      }
+
+      bool rc = ferror(fd) == 0;
+      if (fclose(fd) != 0) rc = false;
+      if (!rc) fprintf(stderr, "%s: Write error.\n", path);
+      return rc;
+}
+
+static void usage(const char*name)
+{
+      fprintf(stderr,
+	      "Usage: %s [-j <jobs>] [-l] -o <output> <input>...\n"
+	      "Merge vvp statement coverage databases.\n"
+	      " -j jobs       Number of merge threads (default 1)\n"
+	      " -l            List the merged counts on stdout\n"
+	      " -o file       Write the merged database to file\n"
+	      " -v            Print a summary when done\n", name);
+}
+
+int main(int argc, char*argv[])
+{
+      const char*out_path = 0;
+      unsigned jobs = 1;
+      bool verbose = false;
+      bool list = false;
+      int opt;
+
+      while ((opt = getopt(argc, argv, "hj:lo:v")) != EOF) switch (opt) {
+	  case 'h':
+	    usage(argv[0]);
+	    return 0;
+	  case 'j':
+	    jobs = strtoul(optarg, 0, 0);
+	    if (jobs == 0) jobs = 1;
+	    break;
+	  case 'l':
+	    list = true;
+	    break;
+	  case 'o':
+	    out_path = optarg;
+	    break;
+	  case 'v':
+	    verbose = true;
+	    break;
+	  default:
+	    usage(argv[0]);
+	    return 1;
+      }
+
+      if (out_path == 0 || optind >= argc) {
+	    usage(argv[0]);
+	    return 1;
+      }
+
+      inputs.resize(argc - optind);
+      for (size_t idx = 0 ; idx < inputs.size() ; idx += 1) {
+	    inputs[idx].path = argv[optind + idx];
+	    if (! load_input(inputs[idx])) {
+		  for (size_t tmp = 0 ; tmp <= idx ; tmp += 1)
+			unload_input(inputs[tmp]);
+		  return 1;
+	    }
+      }
+
+	/* Build the global file table, sorted by name. */
+      map<string,uint32_t> file_index;
+      for (size_t idx = 0 ; idx < inputs.size() ; idx += 1) {
+	    for (size_t fn = 0 ; fn < inputs[idx].names.size() ; fn += 1)
+		  file_index[inputs[idx].names[fn]] = 0;
+      }
+      for (map<string,uint32_t>::iterator cur = file_index.begin()
+		 ; cur != file_index.end() ; ++ cur) {
+	    cur->second = global_files.size();
+	    global_files.push_back(cur->first);
+      }
+
+	/* Locate the run of each input for each global file. */
+      for (size_t idx = 0 ; idx < inputs.size() ; idx += 1) {
+	    cov_input&in = inputs[idx];
+	    in.file_runs.assign(global_files.size(),
+				pair<uint32_t,uint32_t>(0, 0));
+	    uint32_t start = 0;
+	    while (start < in.nlines) {
+		  uint32_t local = get_u32(in.lines + start*LINE_SIZE);
+		  uint32_t stop = start + 1;
+		  while (stop < in.nlines
+			 && get_u32(in.lines + stop*LINE_SIZE) == local)
+			stop += 1;
+		  uint32_t global = file_index[in.names[local]];
+		  in.file_runs[global] = pair<uint32_t,uint32_t>(start, stop);
+		  start = stop;
+	    }
+      }
+
+      merged.resize(global_files.size());
+      if (jobs > global_files.size()) jobs = global_files.size();
+      if (jobs <= 1) {
+	    merge_worker(0);
+      } else {
+	    vector<pthread_t> threads (jobs);
+	    unsigned started = 0;
+	    for ( ; started < jobs ; started += 1) {
+		  if (pthread_create(&threads[started], 0, merge_worker, 0) != 0)
+			break;
+	    }
+	      /* Whatever could not be started is done here. */
+	    merge_worker(0);
+	    for (unsigned idx = 0 ; idx < started ; idx += 1)
+		  pthread_join(threads[idx], 0);
+      }
+
+      bool rc = write_output(out_path);
+
+      if (list && rc) {
+	    for (size_t idx = 0 ; idx < merged.size() ; idx += 1) {
+		  const vector<line_count>&cur = merged[idx];
+		  for (size_t ln = 0 ; ln < cur.size() ; ln += 1)
+			printf("%s:%u: %llu\n", global_files[idx].c_str(),
+			       (unsigned)cur[ln].line,
+			       (unsigned long long)cur[ln].count);
+	    }
+      }
+
+      if (verbose && rc) {
+	    size_t nlines = 0, hit = 0;
+	    for (size_t idx = 0 ; idx < merged.size() ; idx += 1) {
+		  nlines += merged[idx].size();
+		  for (size_t ln = 0 ; ln < merged[idx].size() ; ln += 1)
+			if (merged[idx][ln].count) hit += 1;
+	    }
+	    fprintf(stderr, "%s: %zu inputs, %zu files, %zu of %zu lines "
+		    "covered.\n", out_path, inputs.size(), global_files.size(),
+		    hit, nlines);
+      }
+
+      for (size_t idx = 0 ; idx < inputs.size() ; idx += 1)
+	    unload_input(inputs[idx]);
+
+      return rc ? 0 : 1;
+}
@@ -20,10 +20,12 @@
 #include "delay.h"
 #include "schedule.h"
 #include "vpi_priv.h"
+#include "statistics.h"
 #include "config.h"
 #ifdef CHECK_WITH_VALGRIND
 #include "vvp_cleanup.h"
 #endif
+#include "slab.h"
 #include <iostream>
 #include <cstdlib>
 #include <list>
@@ -150,6 +152,35 @@ void vvp_delay_t::set_decay(vvp_time64_t val)
 	    calculate_min_delay_();
 }
 
+/*
+ * Every change on the input of a delay functor creates an event, and
+ * gate level netlists have one of these functors per cell output, so
+ * the events are allocated from a slab heap instead of with the
+ * general purpose allocator.
+ */
+static const size_t DELAY_EVENT_CHUNK_COUNT = 8192 / sizeof(struct vvp_fun_delay::event_);
+static slab_t<sizeof(vvp_fun_delay::event_),DELAY_EVENT_CHUNK_COUNT> delay_event_heap;
+
+void* vvp_fun_delay::event_::operator new(size_t size)
+{
+      assert(size == sizeof(struct event_));
+      return delay_event_heap.alloc_slab();
+}
+
+void vvp_fun_delay::event_::operator delete(void*ptr)
+{
+      delay_event_heap.free_slab(ptr);
+}
+
+unsigned long count_delay_event_pool(void) { return delay_event_heap.pool; }
+
+#ifdef CHECK_WITH_VALGRIND
+void delay_event_pool_delete(void)
+{
+      delay_event_heap.delete_pool();
+}
+#endif
+
 vvp_fun_delay::vvp_fun_delay(vvp_net_t*n, unsigned width, const vvp_delay_t&d)
 : net_(n), delay_(d)
 {
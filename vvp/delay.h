@@ -75,6 +75,10 @@ class vvp_delay_t {
 class vvp_fun_delay  : public vvp_net_fun_t, private vvp_gen_event_s {
 
       enum delay_type_t {UNKNOWN_DELAY, VEC4_DELAY, VEC8_DELAY, REAL_DELAY};
+
+    public:
+	// This is public only so that delay.cc can size the slab
+	// heap that these events are allocated from.
       struct event_ {
 	    explicit event_(vvp_time64_t s) : sim_time(s) {
 		  ptr_real = 0.0;
@@ -86,6 +90,9 @@ class vvp_fun_delay  : public vvp_net_fun_t, private vvp_gen_event_s {
 	    vvp_vector8_t ptr_vec8;
 	    double ptr_real;
 	    struct event_*next;
+
+	    static void* operator new(size_t);
+	    static void operator delete(void*);
       };
 
     public:
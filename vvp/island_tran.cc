@@ -22,17 +22,55 @@
 # include  "symbols.h"
 # include  "schedule.h"
 # include  <list>
+# include  <map>
+# include  <vector>
 
 # include  <iostream>
 
 using namespace std;
 
+struct vvp_island_branch_tran;
+
+/*
+ * A tran island is often much larger than the part of it that is
+ * affected by a given input change: the compiler puts every branch
+ * that shares a net into one island, and that includes the enable
+ * inputs, so for example a bank of tranif gates with a common enable
+ * is a single island. The island is therefore split (on the first
+ * run) into components of branches that are connected through their
+ * A/B ports, and only the components that have seen a change on one
+ * of their ports (including the ports that enable their branches)
+ * are rerun.
+ */
 class vvp_island_tran : public vvp_island {
 
     public:
+      vvp_island_tran();
+
       void run_island();
+      void mark_port(vvp_island_port*port);
       void count_drivers(vvp_island_port*port, unsigned bit_idx,
                          unsigned counts[3]);
+
+    private:
+      void build_components_();
+      void mark_components_(map<vvp_island_port*, vector<unsigned> >&use,
+                            vvp_island_port*port);
+      void mark_component_(unsigned idx);
+      void output_port_(vvp_net_t*net);
+
+      struct component_s {
+	    vector<vvp_island_branch_tran*> branches;
+	    bool dirty;
+      };
+      vector<component_s> components_;
+      vector<unsigned> dirty_;
+	// Map each port to the components that must be rerun when
+	// its input value changes, and to the components that it
+	// enables, which must be rerun when its output value changes.
+      map<vvp_island_port*, vector<unsigned> > port_components_;
+      map<vvp_island_port*, vector<unsigned> > enable_components_;
+      bool built_;
 };
 
 enum tran_state_t {
@@ -48,7 +86,6 @@ struct vvp_island_branch_tran : public vvp_island_branch {
                              unsigned offset__, bool resistive__);
       void run_test_enabled();
       void run_resolution();
-      void run_output();
 
       vvp_net_t*en;
       unsigned width, part, offset;
@@ -68,41 +105,188 @@ vvp_island_branch_tran::vvp_island_branch_tran(vvp_net_t*en__,
       state = en__ ? tran_disabled : tran_enabled;
 }
 
+/*
+ * All the branches of a tran island are tran branches, and all the
+ * nets that they connect have island ports as their functor, so these
+ * casts can be static.
+ */
 static inline vvp_island_branch_tran* BRANCH_TRAN(vvp_island_branch*tmp)
 {
-      vvp_island_branch_tran*res = dynamic_cast<vvp_island_branch_tran*>(tmp);
-      assert(res);
-      return res;
+      return static_cast<vvp_island_branch_tran*>(tmp);
+}
+
+static inline vvp_island_port* PORT(vvp_net_t*net)
+{
+      return static_cast<vvp_island_port*>(net->fun);
+}
+
+vvp_island_tran::vvp_island_tran()
+{
+      built_ = false;
+}
+
+static unsigned find_root(vector<unsigned>&root, unsigned idx)
+{
+      while (root[idx] != idx) {
+	    root[idx] = root[root[idx]];
+	    idx = root[idx];
+      }
+      return idx;
+}
+
+static void add_port_component(vector<unsigned>&list, unsigned comp)
+{
+      for (unsigned idx = 0 ; idx < list.size() ; idx += 1) {
+	    if (list[idx] == comp)
+		  return;
+      }
+      list.push_back(comp);
+}
+
+void vvp_island_tran::build_components_()
+{
+      vector<vvp_island_branch_tran*> all;
+      for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch)
+	    all.push_back(BRANCH_TRAN(cur));
+
+	// Join branches that share a port.
+      vector<unsigned> root (all.size());
+      map<vvp_net_t*,unsigned> port_branch;
+      for (unsigned idx = 0 ; idx < all.size() ; idx += 1) {
+	    root[idx] = idx;
+	    vvp_net_t*ends[2] = { all[idx]->a, all[idx]->b };
+	    for (unsigned ab = 0 ; ab < 2 ; ab += 1) {
+		  map<vvp_net_t*,unsigned>::iterator cur = port_branch.find(ends[ab]);
+		  if (cur == port_branch.end()) {
+			port_branch[ends[ab]] = idx;
+			continue;
+		  }
+		  unsigned ra = find_root(root, idx);
+		  unsigned rb = find_root(root, cur->second);
+		  if (ra != rb)
+			root[ra] = rb;
+	    }
+      }
+
+	// Collect the branches of each component, keeping the order
+	// of the island branch list.
+      map<unsigned,unsigned> comp_of_root;
+      for (unsigned idx = 0 ; idx < all.size() ; idx += 1) {
+	    unsigned rdx = find_root(root, idx);
+	    map<unsigned,unsigned>::iterator cur = comp_of_root.find(rdx);
+	    unsigned comp;
+	    if (cur == comp_of_root.end()) {
+		  comp = components_.size();
+		  comp_of_root[rdx] = comp;
+		  components_.push_back(component_s());
+		  components_.back().dirty = false;
+	    } else {
+		  comp = cur->second;
+	    }
+
+	    vvp_island_branch_tran*br = all[idx];
+	    components_[comp].branches.push_back(br);
+	    add_port_component(port_components_[PORT(br->a)], comp);
+	    add_port_component(port_components_[PORT(br->b)], comp);
+	    if (br->en) {
+		  add_port_component(port_components_[PORT(br->en)], comp);
+		  add_port_component(enable_components_[PORT(br->en)], comp);
+	    }
+      }
+
+	// Everything needs to be run the first time.
+      for (unsigned idx = 0 ; idx < components_.size() ; idx += 1)
+	    mark_component_(idx);
+
+      built_ = true;
+}
+
+void vvp_island_tran::mark_component_(unsigned idx)
+{
+      if (components_[idx].dirty)
+	    return;
+
+      components_[idx].dirty = true;
+      dirty_.push_back(idx);
+}
+
+void vvp_island_tran::mark_port(vvp_island_port*port)
+{
+	// Before the components are built, everything is dirty.
+      if (! built_)
+	    return;
+
+      mark_components_(port_components_, port);
+}
+
+void vvp_island_tran::mark_components_(map<vvp_island_port*, vector<unsigned> >&use,
+                                       vvp_island_port*port)
+{
+      map<vvp_island_port*, vector<unsigned> >::iterator cur = use.find(port);
+      if (cur == use.end())
+	    return;
+
+      for (unsigned idx = 0 ; idx < cur->second.size() ; idx += 1)
+	    mark_component_(cur->second[idx]);
+}
+
+/*
+ * Send the resolved value of the port out of the island. If the
+ * value changes and the port also enables branches (of this or some
+ * other component) then those components need to be rerun the next
+ * time the island runs.
+ */
+void vvp_island_tran::output_port_(vvp_net_t*net)
+{
+      vvp_island_port*port = PORT(net);
+      if (port->value.size() == 0)
+	    return;
+
+      if (! port->outvalue.eeq(port->value)) {
+	    island_send_value(net, port->value);
+	    mark_components_(enable_components_, port);
+      }
+      port->value = vvp_vector8_t::nil;
 }
 
 /*
  * The run_island() method is called by the scheduler to run the
- * entire island. We run the island by calling run_resolution() for
- * all the branches in the island.
+ * island. We run the island by calling run_resolution() for all the
+ * branches in the components that need to be rerun.
 */
 void vvp_island_tran::run_island()
 {
+      if (! built_)
+	    build_components_();
+
+      vector<unsigned> run;
+      run.swap(dirty_);
+      for (unsigned idx = 0 ; idx < run.size() ; idx += 1)
+	    components_[run[idx]].dirty = false;
+
 	// Test to see if any of the branches are enabled. This loop
 	// tests the enabled inputs for all the branches and caches
 	// the results in the state for each branch.
-      for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch) {
-	    vvp_island_branch_tran*tmp = dynamic_cast<vvp_island_branch_tran*>(cur);
-	    assert(tmp);
-	    tmp->run_test_enabled();
+      for (unsigned idx = 0 ; idx < run.size() ; idx += 1) {
+	    vector<vvp_island_branch_tran*>&list = components_[run[idx]].branches;
+	    for (unsigned bdx = 0 ; bdx < list.size() ; bdx += 1)
+		  list[bdx]->run_test_enabled();
       }
 
-	// Now resolve all the branches in the island.
-      for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch) {
-	    vvp_island_branch_tran*tmp = dynamic_cast<vvp_island_branch_tran*>(cur);
-	    assert(tmp);
-	    tmp->run_resolution();
+	// Now resolve all the branches.
+      for (unsigned idx = 0 ; idx < run.size() ; idx += 1) {
+	    vector<vvp_island_branch_tran*>&list = components_[run[idx]].branches;
+	    for (unsigned bdx = 0 ; bdx < list.size() ; bdx += 1)
+		  list[bdx]->run_resolution();
       }
 
 	// Now output the resolved values.
-      for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch) {
-	    vvp_island_branch_tran*tmp = dynamic_cast<vvp_island_branch_tran*>(cur);
-	    assert(tmp);
-	    tmp->run_output();
+      for (unsigned idx = 0 ; idx < run.size() ; idx += 1) {
+	    vector<vvp_island_branch_tran*>&list = components_[run[idx]].branches;
+	    for (unsigned bdx = 0 ; bdx < list.size() ; bdx += 1) {
+		  output_port_(list[bdx]->a);
+		  output_port_(list[bdx]->b);
+	    }
       }
 }
 
@@ -185,7 +369,7 @@ void vvp_island_tran::count_drivers(vvp_island_port*port, unsigned bit_idx,
 
 void vvp_island_branch_tran::run_test_enabled()
 {
-      vvp_island_port*ep = en? dynamic_cast<vvp_island_port*> (en->fun) : 0;
+      vvp_island_port*ep = en? PORT(en) : 0;
 
 	// If there is no ep port (no "enabled" input) then this is a
 	// tran branch. Assume it is always enabled.
@@ -279,7 +463,7 @@ static void push_value_through_branch(const vvp_vector8_t&val,
       unsigned dst_ab = src_ab^1;
 
       vvp_net_t*dst_net = dst_ab? branch->b : branch->a;
-      vvp_island_port*dst_port = dynamic_cast<vvp_island_port*>(dst_net->fun);
+      vvp_island_port*dst_port = PORT(dst_net);
 
       vvp_vector8_t old_val = dst_port->value;
 
@@ -345,7 +529,7 @@ void vvp_island_branch_tran::run_resolution()
 
 	// If the A side port hasn't already been visited, then push
         // its input value through all the branches connected to it.
-      port = dynamic_cast<vvp_island_port*>(a->fun);
+      port = PORT(a);
       if (port->value.size() == 0) {
 	    vvp_branch_ptr_t a_side(this, 0);
 	    island_collect_node(connections, a_side);
@@ -360,7 +544,7 @@ void vvp_island_branch_tran::run_resolution()
 	// Do the same for the B side port. Note that if the branch
         // is enabled, the B side port will have already been visited
         // when we resolved the A side port.
-      port = dynamic_cast<vvp_island_port*>(b->fun);
+      port = PORT(b);
       if (port->value.size() == 0) {
 	    vvp_branch_ptr_t b_side(this, 1);
 	    island_collect_node(connections, b_side);
@@ -373,26 +557,6 @@ void vvp_island_branch_tran::run_resolution()
       }
 }
 
-void vvp_island_branch_tran::run_output()
-{
-      vvp_island_port*port;
-
-	// If the A side port hasn't already been updated, send the
-        // resolved value to the output.
-      port = dynamic_cast<vvp_island_port*>(a->fun);
-      if (port->value.size() != 0) {
-	    island_send_value(a, port->value);
-	    port->value = vvp_vector8_t::nil;
-      }
-
-	// Do the same for the B side port.
-      port = dynamic_cast<vvp_island_port*>(b->fun);
-      if (port->value.size() != 0) {
-	    island_send_value(b, port->value);
-	    port->value = vvp_vector8_t::nil;
-      }
-}
-
 void compile_island_tran(char*label)
 {
       vvp_island*use_island = new vvp_island_tran;
@@ -22,14 +22,17 @@ const char COPYRIGHT[] =
 # include  "config.h"
 # include  "parse_misc.h"
 # include  "compile.h"
+# include  "coverage.h"
 # include  "schedule.h"
 # include  "vpi_priv.h"
 # include  "statistics.h"
 # include  "vvp_cleanup.h"
 # include  "vvp_object.h"
+# include  "vvp_sparse_array.h"
 # include  <cstdio>
 # include  <cstdlib>
 # include  <cstring>
+# include  <string>
 # include  <unistd.h>
 # include  <cassert>
 #ifdef CHECK_WITH_VALGRIND
@@ -68,6 +71,13 @@ void vpip_set_return_value(int value)
       vvp_return_value = value;
 }
 
+static unsigned fork_test_index = 0;
+
+void vpip_set_fork_test_index(unsigned index)
+{
+      fork_test_index = index;
+}
+
 static char log_buffer[4096];
 
 #if defined(HAVE_SYS_RESOURCE_H)
@@ -228,8 +238,11 @@ static void final_cleanup()
       udp_defns_delete();
       island_delete();
       signal_pool_delete();
+      shared_dec_const_delete();
       vvp_net_pool_delete();
+      delay_event_pool_delete();
       ufunc_pool_delete();
+      vthread_pool_delete();
 #endif
 	/*
 	 * Unload the VPI modules. This is essential for MinGW, to ensure
@@ -261,6 +274,7 @@ int main(int argc, char*argv[])
       const char*design_path = 0;
       struct rusage cycles[3];
       const char *logfile_name = 0x0;
+      const char *coverage_name = "coverage.dat";
       FILE *logfile = 0x0;
       extern void vpi_set_vlog_info(int, char**);
       extern bool stop_is_finish;
@@ -282,11 +296,12 @@ int main(int argc, char*argv[])
         /* For non-interactive runs we do not want to run the interactive
          * debugger, so make $stop just execute a $finish. */
       stop_is_finish = false;
-      while ((opt = getopt(argc, argv, "+hil:M:m:nNsvV")) != EOF) switch (opt) {
+      while ((opt = getopt(argc, argv, "+c:hil:M:m:nNsvV")) != EOF) switch (opt) {
          case 'h':
            fprintf(stderr,
                    "Usage: vvp [options] input-file [+plusargs...]\n"
                    "Options:\n"
+                   " -c file        Coverage database (default coverage.dat)\n"
                    " -h             Print this help message.\n"
                    " -i             Interactive mode (unbuffered stdio).\n"
                    " -l file        Logfile, '-' for <stderr>\n"
@@ -299,6 +314,9 @@ int main(int argc, char*argv[])
                    " -v             Verbose progress messages.\n"
                    " -V             Print the version information.\n" );
            exit(0);
+	  case 'c':
+	    coverage_name = optarg;
+	    break;
 	  case 'i':
 	    setvbuf(stdout, 0, _IONBF, 0);
 	    break;
@@ -457,6 +475,8 @@ int main(int argc, char*argv[])
 	    vpi_mcd_printf(1, "           %8lu real (%lu words)\n",
 			   count_real_arrays, count_real_array_words);
 	    vpi_mcd_printf(1, " ... %8lu scopes\n",   count_vpi_scopes);
+	    vpi_mcd_printf(1, " ... %8lu constants (%lu uses)\n",
+			   count_const_vectors, count_const_vector_uses);
       }
 
       if (verbose_flag) {
@@ -481,6 +501,8 @@ int main(int argc, char*argv[])
 		    count_assign_events);
 	    vpi_mcd_printf(1, "             ...assign(vec4) pool=%lu\n",
 			   count_assign4_pool());
+	    vpi_mcd_printf(1, "             ...assign(const) pool=%lu\n",
+			   count_assign_const4_pool());
 	    vpi_mcd_printf(1, "             ...assign(vec8) pool=%lu\n",
 			   count_assign8_pool());
 	    vpi_mcd_printf(1, "             ...assign(real) pool=%lu\n",
@@ -491,6 +513,33 @@ int main(int argc, char*argv[])
 			   count_assign_arword_pool());
 	    vpi_mcd_printf(1, "    %8lu other events (pool=%lu)\n",
 			   count_gen_events, count_gen_pool());
+	    vpi_mcd_printf(1, "             ...delay pool=%lu\n",
+			   count_delay_event_pool());
+	    if (count_sparse_arrays > 0) {
+		  vpi_mcd_printf(1, "Sparse memories:\n");
+		  vpi_mcd_printf(1, "    %8lu memories, %lu of %lu words "
+				 "resident\n", count_sparse_arrays,
+				 count_sparse_array_pages
+				 * vvp_vector4array_sparse::page_words(),
+				 count_sparse_array_words);
+	    }
+      }
+
+	/* If the design was compiled with coverage points, then save
+	   the counts that they collected. */
+      if (coverage_point_count() > 0) {
+	    std::string cov_path = coverage_name;
+	      /* A test started by $fork_tests writes its own database
+		 so that the tests do not overwrite each other. */
+	    if (fork_test_index > 0) {
+		  char buf[32];
+		  snprintf(buf, sizeof buf, ".%u", fork_test_index);
+		  cov_path += buf;
+	    }
+	    if (verbose_flag)
+		  vpi_mcd_printf(1, "Coverage: %lu points written to %s\n",
+				 coverage_point_count(), cov_path.c_str());
+	    coverage_write(cov_path.c_str());
       }
 
       final_cleanup();
@@ -106,7 +106,7 @@ static struct __vpiModPath*modpath_dst = 0;
 %token K_vpi_call K_vpi_call_w K_vpi_call_i
 %token K_vpi_func K_vpi_func_r K_vpi_func_s
 %token K_ivl_version K_ivl_delay_selection
-%token K_vpi_module K_vpi_time_precision K_file_names K_file_line
+%token K_vpi_module K_vpi_time_precision K_file_names K_file_line K_cov
 %token K_PORT_INPUT K_PORT_OUTPUT K_PORT_INOUT K_PORT_MIXED K_PORT_NODIR
 
 %token <text> T_INSTR
@@ -642,6 +642,11 @@ statement
 		{ assert($5 == 0);
 		  compile_file_line($1, $3, $4, 0); }
 
+  /* %cov statements mark a coverage point. The operands are the file
+     index and line number of the statement. */
+	| label_opt K_cov T_NUMBER T_NUMBER ';'
+		{ compile_coverage_point($1, $3, $4); }
+
   /* %vpi_call statements are instructions that have unusual operand
      requirements so are handled by their own rules. The %vpi_func
      statement is a variant of %vpi_call that includes a thread vector
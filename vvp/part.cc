@@ -117,12 +117,23 @@ void vvp_fun_part_aa::reset_instance(vvp_context_t context)
       val->set_to_x();
 }
 
+size_t vvp_fun_part_aa::instance_size() const
+{
+      return sizeof(vvp_vector4_t);
+}
+
+void vvp_fun_part_aa::place_instance(vvp_context_t context, void*mem)
+{
+      vvp_set_context_item(context, context_idx_, new (mem) vvp_vector4_t);
+}
+
 #ifdef CHECK_WITH_VALGRIND
 void vvp_fun_part_aa::free_instance(vvp_context_t context)
 {
       vvp_vector4_t*val = static_cast<vvp_vector4_t*>
             (vvp_get_context_item(context, context_idx_));
-      delete val;
+	/* The instance lives in the context block. */
+      val->~vvp_vector4_t();
 }
 #endif
 
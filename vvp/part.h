@@ -75,6 +75,8 @@ class vvp_fun_part_aa  : public vvp_fun_part, public automatic_hooks_s {
     public:
       void alloc_instance(vvp_context_t context);
       void reset_instance(vvp_context_t context);
+      size_t instance_size() const;
+      void place_instance(vvp_context_t context, void*mem);
 #ifdef CHECK_WITH_VALGRIND
       void free_instance(vvp_context_t context);
 #endif
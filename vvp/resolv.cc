@@ -169,12 +169,8 @@ void resolv_tri::recv_vec8_(unsigned port, const vvp_vector8_t&bit)
             port = port / 4;
       }
 
-      if (! hiz_value_.is_hiz()) {
-	    for (unsigned idx = 0 ;  idx < val_[base].size() ;  idx += 1) {
-		  val_[base].set_bit(idx, resolve(val_[base].value(idx),
-						  hiz_value_));
-	    }
-      }
+      if (! hiz_value_.is_hiz())
+	    val_[base] = resolve(val_[base], hiz_value_);
 
       net_->send_vec8(val_[base]);
 }
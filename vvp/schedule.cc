@@ -222,6 +222,48 @@ void assign_vector4_event_s::operator delete(void*dptr)
 
 unsigned long count_assign4_pool(void) { return assign4_heap.pool; }
 
+/*
+ * Assign an interned constant. The value is shared with every other
+ * use of the same constant, so the event only carries a pointer.
+ */
+struct assign_const4_event_s  : public event_s {
+      ~assign_const4_event_s() { const_vector4_release(val); }
+      vvp_net_ptr_t ptr;
+      const_vector4_s*val;
+      void run_run(void);
+      void single_step_display(void);
+
+      static void* operator new(size_t);
+      static void operator delete(void*);
+};
+
+void assign_const4_event_s::run_run(void)
+{
+      count_assign_events += 1;
+      vvp_send_vec4(ptr, val->val, 0);
+}
+
+void assign_const4_event_s::single_step_display(void)
+{
+      cerr << "assign_const4_event: Propagate val=" << val->val << endl;
+}
+
+static const size_t ASSIGNC4_CHUNK_COUNT = 524288 / sizeof(struct assign_const4_event_s);
+static slab_t<sizeof(assign_const4_event_s),ASSIGNC4_CHUNK_COUNT> assignc4_heap;
+
+inline void* assign_const4_event_s::operator new(size_t size)
+{
+      assert(size == sizeof(assign_const4_event_s));
+      return assignc4_heap.alloc_slab();
+}
+
+void assign_const4_event_s::operator delete(void*dptr)
+{
+      assignc4_heap.free_slab(dptr);
+}
+
+unsigned long count_assign_const4_pool(void) { return assignc4_heap.pool; }
+
 struct assign_vector8_event_s  : public event_s {
       vvp_net_ptr_t ptr;
       vvp_vector8_t val;
@@ -942,6 +984,14 @@ void schedule_set_vector(vvp_net_ptr_t ptr, const vvp_vector4_t&bit)
       schedule_event_(cur, 0, SEQ_ACTIVE);
 }
 
+void schedule_set_const_vector(vvp_net_ptr_t ptr, const_vector4_s*bit)
+{
+      struct assign_const4_event_s*cur = new struct assign_const4_event_s;
+      cur->ptr = ptr;
+      cur->val = bit;
+      schedule_event_(cur, 0, SEQ_ACTIVE);
+}
+
 void schedule_set_vector(vvp_net_ptr_t ptr, const vvp_vector8_t&bit)
 {
       struct assign_vector8_event_s*cur = new struct assign_vector8_event_s;
@@ -967,6 +1017,14 @@ void schedule_init_vector(vvp_net_ptr_t ptr, const vvp_vector4_t&bit)
       schedule_init_event(cur);
 }
 
+void schedule_init_const_vector(vvp_net_ptr_t ptr, const_vector4_s*bit)
+{
+      struct assign_const4_event_s*cur = new struct assign_const4_event_s;
+      cur->ptr = ptr;
+      cur->val = bit;
+      schedule_init_event(cur);
+}
+
 void schedule_init_vector(vvp_net_ptr_t ptr, const vvp_vector8_t&bit)
 {
       struct assign_vector8_event_s*cur = new struct assign_vector8_event_s;
@@ -1287,6 +1345,7 @@ void schedule_delete(void)
 {
       vthread_event_heap.delete_pool();
       assign4_heap.delete_pool();
+      assignc4_heap.delete_pool();
       assign8_heap.delete_pool();
       assignr_heap.delete_pool();
       array_w_heap.delete_pool();
@@ -94,6 +94,17 @@ extern void schedule_set_vector(vvp_net_ptr_t ptr, const vvp_vector4_t&val);
 extern void schedule_set_vector(vvp_net_ptr_t ptr, const vvp_vector8_t&val);
 extern void schedule_set_vector(vvp_net_ptr_t ptr, double val);
 
+/*
+ * These are the same as schedule_set_vector and schedule_init_vector
+ * for a vvp_vector4_t, but the event refers to an interned constant
+ * from compile_const_vector4() instead of holding a copy of it. The
+ * event takes over the caller's reference to the constant and
+ * releases it when the event is deleted.
+ */
+struct const_vector4_s;
+extern void schedule_set_const_vector(vvp_net_ptr_t ptr, const_vector4_s*val);
+extern void schedule_init_const_vector(vvp_net_ptr_t ptr, const_vector4_s*val);
+
 /*
  * Create a T0 event for always_comb/latch processes. This is the first
  * event in the first inactive region.
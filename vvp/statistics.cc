@@ -35,5 +35,8 @@ unsigned long count_vpi_nets = 0;
 
 unsigned long count_vpi_scopes = 0;
 
+unsigned long count_const_vectors = 0;
+unsigned long count_const_vector_uses = 0;
+
 size_t size_opcodes = 0;
 
@@ -37,12 +37,18 @@ extern unsigned long count_vvp_nets;
 extern unsigned long count_vpi_nets;
 extern unsigned long count_vpi_scopes;
 
+extern unsigned long count_const_vectors;
+extern unsigned long count_const_vector_uses;
+
 extern unsigned long count_net_arrays;
 extern unsigned long count_net_array_words;
 extern unsigned long count_var_arrays;
 extern unsigned long count_var_array_words;
 extern unsigned long count_real_arrays;
 extern unsigned long count_real_array_words;
+extern unsigned long count_sparse_arrays;
+extern unsigned long count_sparse_array_words;
+extern unsigned long count_sparse_array_pages;
 
 
 extern unsigned long count_time_events;
@@ -50,6 +56,7 @@ extern unsigned long count_time_pool(void);
 
 extern unsigned long count_assign_events;
 extern unsigned long count_assign4_pool(void);
+extern unsigned long count_assign_const4_pool(void);
 extern unsigned long count_assign8_pool(void);
 extern unsigned long count_assign_real_pool(void);
 extern unsigned long count_assign_aword_pool(void);
@@ -57,6 +64,7 @@ extern unsigned long count_assign_arword_pool(void);
 
 extern unsigned long count_gen_events;
 extern unsigned long count_gen_pool(void);
+extern unsigned long count_delay_event_pool(void);
 
 extern size_t size_opcodes;
 extern size_t size_vvp_nets;
@@ -273,7 +273,7 @@ static void cmd_list(unsigned, char*[])
 
 		case vpiReg:
 		  sig = dynamic_cast<__vpiSignal*>(table[idx]);
-		  if ((sig->msb.get_value() == 0) && (sig->lsb.get_value() == 0))
+		  if ((sig->msb == 0) && (sig->lsb == 0))
 			printf("reg     : %s%s\n",
 			       vpi_get_str(vpiName, table[idx]),
 			       sig->signed_flag? "signed " : "");
@@ -281,12 +281,12 @@ static void cmd_list(unsigned, char*[])
 			printf("reg     : %s%s[%d:%d]\n",
 			       vpi_get_str(vpiName, table[idx]),
 			       sig->signed_flag? "signed " : "",
-			       sig->msb.get_value(), sig->lsb.get_value());
+			       sig->msb, sig->lsb);
 		  break;
 
 		case vpiNet:
 		  sig = dynamic_cast<__vpiSignal*>(table[idx]);
-		  if ((sig->msb.get_value() == 0) && (sig->lsb.get_value() == 0))
+		  if ((sig->msb == 0) && (sig->lsb == 0))
 			printf("net     : %s%s\n",
 			       vpi_get_str(vpiName, table[idx]),
 			       sig->signed_flag? "signed " : "");
@@ -294,7 +294,7 @@ static void cmd_list(unsigned, char*[])
 			printf("net     : %s%s[%d:%d]\n",
 			       vpi_get_str(vpiName, table[idx]),
 			       sig->signed_flag? "signed " : "",
-			       sig->msb.get_value(), sig->lsb.get_value());
+			       sig->msb, sig->lsb);
 		  break;
 
 		case vpiPort:
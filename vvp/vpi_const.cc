@@ -27,6 +27,7 @@
 # include  <cstdlib>
 # include  <cstring>
 # include  <cassert>
+# include  <map>
 # include  "ivl_alloc.h"
 
 class __vpiStringConst : public __vpiHandle {
@@ -620,6 +621,24 @@ void __vpiDecConst::vpi_get_value(p_vpi_value vp)
       }
 }
 
+static std::map<int,__vpiDecConst*> shared_dec_consts;
+
+__vpiDecConst* vpip_shared_dec_const(int val)
+{
+      __vpiDecConst*&obj = shared_dec_consts[val];
+      if (obj == 0) obj = new __vpiDecConst(val);
+      return obj;
+}
+
+#ifdef CHECK_WITH_VALGRIND
+void shared_dec_const_delete(void)
+{
+      for (std::map<int,__vpiDecConst*>::iterator cur = shared_dec_consts.begin()
+		 ; cur != shared_dec_consts.end() ; ++ cur)
+	    delete cur->second;
+      shared_dec_consts.clear();
+}
+#endif
 
 inline __vpiRealConst::__vpiRealConst(double val)
 : value(val)
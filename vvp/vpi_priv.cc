@@ -123,7 +123,7 @@ struct vpip_string_chunk {
 
 unsigned vpip_size(__vpiSignal *sig)
 {
-      return abs(sig->msb.get_value() - sig->lsb.get_value()) + 1;
+      return abs(sig->msb - sig->lsb) + 1;
 }
 
 __vpiScope* vpip_scope(__vpiSignal*sig)
@@ -1311,41 +1311,17 @@ vpiHandle vpi_handle_by_index(vpiHandle ref, PLI_INT32 idx)
 
 static vpiHandle find_name(const char *name, vpiHandle handle)
 {
-      vpiHandle rtn = 0;
       __vpiScope*ref = dynamic_cast<__vpiScope*>(handle);
 
+      /* Look the name up in the scope's name index. That skips the
+       * ports, since the standard says that a port does not have a
+       * full name and so cannot be found by name. */
+      vpiHandle rtn = ref->find_item(name);
+
       /* check module names */
-      if (!strcmp(name, vpi_get_str(vpiName, handle)))
+      if (rtn == 0 && !strcmp(name, vpi_get_str(vpiName, handle)))
 	    rtn = handle;
 
-      /* brute force search for the name in all objects in this scope */
-      for (unsigned i = 0 ;  i < ref->intern.size() ;  i += 1) {
-	      /* The standard says that since a port does not have a full
-	       * name it cannot be found by name. Because of this we need
-	       * to skip ports here so the correct handle can be located. */
-	    if (vpi_get(vpiType, ref->intern[i]) == vpiPort) continue;
-	    char *nm = vpi_get_str(vpiName, ref->intern[i]);
-	    if (nm && !strcmp(name, nm)) {
-		  rtn = ref->intern[i];
-		  break;
-	    } else if (vpi_get(vpiType, ref->intern[i]) == vpiMemory ||
-	               vpi_get(vpiType, ref->intern[i]) == vpiNetArray) {
-		  /* We need to iterate on the words */
-		  vpiHandle word_i, word_h;
-		  word_i = vpi_iterate(vpiMemoryWord, ref->intern[i]);
-		  while (word_i && (word_h = vpi_scan(word_i))) {
-			nm = vpi_get_str(vpiName, word_h);
-			if (nm && !strcmp(name, nm)) {
-			      rtn = word_h;
-			      vpi_free_object(word_i);
-			      break;
-			}
-		  }
-	    }
-	    /* found it yet? */
-	    if (rtn) break;
-      }
-
       return rtn;
 }
 
@@ -1375,11 +1351,6 @@ static char * find_rest(char *name)
 
 static vpiHandle find_scope(const char *name, vpiHandle handle, int depth)
 {
-
-      vpiHandle iter = handle==0
-	    ? vpi_iterate(vpiModule, NULL)
-	    : vpi_iterate(vpiInternalScope, handle);
-
       vector<char> name_buf (strlen(name)+1);
       strcpy(&name_buf[0], name);
       char*nm_first = &name_buf[0];
@@ -1389,26 +1360,20 @@ static vpiHandle find_scope(const char *name, vpiHandle handle, int depth)
 	    *nm_rest++ = 0;
       }
 
-      vpiHandle rtn = 0;
-      vpiHandle hand;
-      while (iter && (hand = vpi_scan(iter))) {
-	    char *nm = vpi_get_str(vpiName, hand);
-
-	    if (strcmp(nm_first,nm)==0) {
-		  if (nm_rest)
-			rtn=find_scope(nm_rest, hand, depth+1);
-		  else
-			rtn = hand;
-	    }
-
-	    /* found it yet ? */
-	    if (rtn) {
-		  vpi_free_object(iter);
-		  break;
-	    }
+      __vpiScope*hand;
+      if (handle == 0) {
+	    hand = vpip_find_root_module(nm_first);
+      } else {
+	    __vpiScope*ref = dynamic_cast<__vpiScope*>(handle);
+	    hand = ref? ref->find_child_scope(nm_first) : 0;
       }
 
-      return rtn;
+      if (hand == 0)
+	    return 0;
+      if (nm_rest)
+	    return find_scope(nm_rest, hand, depth+1);
+
+      return hand;
 }
 
 // Find the end of the first escaped identifier or simple identifier
@@ -1774,5 +1739,6 @@ vpip_routines_s vpi_routines = {
     .make_systf_system_defined  = vpip_make_systf_system_defined,
     .mcd_rawwrite               = vpip_mcd_rawwrite,
     .set_return_value           = vpip_set_return_value,
+    .set_fork_test_index        = vpip_set_fork_test_index,
 };
 #endif
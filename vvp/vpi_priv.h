@@ -187,6 +187,14 @@ class __vpiDecConst : public __vpiHandle {
       int value;
 };
 
+/*
+ * Return a permanently allocated decimal constant with the given
+ * value. The handles are shared by value, so the many signals that
+ * have the same range, and the words and bits that have the same
+ * index, all use the same few constant objects.
+ */
+extern __vpiDecConst* vpip_shared_dec_const(int val);
+
 /*
  * This represents callback handles. There are some private types that
  * are defined and used in vpi_callback.cc. The __vpiCallback are
@@ -291,20 +299,37 @@ class __vpiScope : public __vpiHandle {
       vvp_context_t live_contexts;
         /* Keep a list of freed contexts. */
       vvp_context_t free_contexts;
+        /* The size in bytes of a context block, including the item
+           instances placed in it. This is calculated the first time
+           a context is allocated. */
+      size_t context_size;
 	/* Keep a list of threads in the scope. */
       std::set<vthread_t> threads;
       signed int time_units :8;
       signed int time_precision :8;
 
+	// Look up an item or a child scope of this scope by its base
+	// name. These are used by vpi_handle_by_name.
+      vpiHandle find_item(const char*name);
+      __vpiScope*find_child_scope(const char*name);
+
     protected:
       __vpiScope(const char*nam, const char*tnam, bool is_auto_flag =false);
 
+    private:
+      void index_names_(void);
+
     private:
 	/* The scope has a name. */
       const char*name_;
       const char*tname_;
 	/* the scope may be "automatic" */
       bool is_automatic_;
+	/* Name indices of the intern items, built on first use and
+	   brought up to date when more items are attached. */
+      std::map<std::string,vpiHandle> item_index_;
+      std::map<std::string,__vpiScope*> child_index_;
+      size_t indexed_count_;
 };
 
 class vpiScopeFunction  : public __vpiScope {
@@ -342,6 +367,7 @@ extern __vpiScope* vpip_peek_context_scope(void);
 extern unsigned vpip_add_item_to_context(automatic_hooks_s*item,
                                          __vpiScope*scope);
 extern vpiHandle vpip_make_root_iterator(int type_code);
+extern __vpiScope*vpip_find_root_module(const char*name);
 extern void vpip_make_root_iterator(class __vpiHandle**&table,
 				    unsigned&ntable);
 
@@ -377,8 +403,9 @@ struct __vpiSignal : public __vpiHandle {
             const char*name;
             vpiHandle index;
       } id;
-	/* The indices that define the width and access offset. */
-      __vpiDecConst msb, lsb;
+	/* The indices that define the width and access offset. The
+	   vpiLeftRange/vpiRightRange handles are made on demand. */
+      int msb, lsb;
 	/* Flags */
       unsigned signed_flag  : 1;
       unsigned is_netarray  : 1; // This is word of a net array
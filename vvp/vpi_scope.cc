@@ -42,6 +42,28 @@ vpiHandle vpip_make_root_iterator(int type_code)
       return make_subset_iterator_(type_code, vpip_root_table);
 }
 
+/*
+ * Find a root module by name. The root table only grows while the
+ * design is compiled, so the index is extended whenever the table
+ * has more entries than were indexed.
+ */
+__vpiScope*vpip_find_root_module(const char*name)
+{
+      static map<string,__vpiScope*> root_index;
+      static size_t root_indexed = 0;
+
+      for ( ; root_indexed < vpip_root_table.size() ; root_indexed += 1) {
+	    vpiHandle obj = vpip_root_table[root_indexed];
+	    if (obj->get_type_code() != vpiModule)
+		  continue;
+	    __vpiScope*scope = dynamic_cast<__vpiScope*>(obj);
+	    root_index.insert(make_pair(string(scope->scope_name()), scope));
+      }
+
+      map<string,__vpiScope*>::const_iterator cur = root_index.find(name);
+      return cur == root_index.end()? 0 : cur->second;
+}
+
 void vpip_make_root_iterator(__vpiHandle**&table, unsigned&ntable)
 {
       table = &vpip_root_table[0];
@@ -338,12 +360,76 @@ static vpiHandle module_iter(int code, vpiHandle obj)
 
 
 __vpiScope::__vpiScope(const char*nam, const char*tnam, bool auto_flag)
-: is_automatic_(auto_flag)
+: is_automatic_(auto_flag), indexed_count_(0)
 {
       name_ = vpip_name_string(nam);
       tname_ = vpip_name_string(tnam? tnam : "");
 }
 
+/*
+ * Add the items attached since the last call to the name indices.
+ * When names repeat, the first item wins, which matches the order a
+ * scan of the intern list would find them in. Ports are skipped
+ * because the standard says they cannot be found by name.
+ */
+void __vpiScope::index_names_(void)
+{
+      for ( ; indexed_count_ < intern.size() ; indexed_count_ += 1) {
+	    vpiHandle obj = intern[indexed_count_];
+	    int type = obj->get_type_code();
+	    if (type == vpiPort)
+		  continue;
+
+	    char*nm = obj->vpi_get_str(vpiName);
+	    if (nm == 0)
+		  continue;
+	    string key (nm);
+	    item_index_.insert(make_pair(key, obj));
+
+	    if (compare_types(vpiInternalScope, type))
+		  child_index_.insert(make_pair(key, dynamic_cast<__vpiScope*>(obj)));
+      }
+}
+
+vpiHandle __vpiScope::find_item(const char*name)
+{
+      index_names_();
+
+      map<string,vpiHandle>::const_iterator cur = item_index_.find(name);
+      if (cur != item_index_.end())
+	    return cur->second;
+
+	/* Array words are not in the index. A name like "mem[3]" is
+	   looked up as the array "mem" and then indexed. */
+      size_t len = strlen(name);
+      const char*lbr = strrchr(name, '[');
+      if (lbr == 0 || lbr == name || name[len-1] != ']')
+	    return 0;
+
+      cur = item_index_.find(string(name, lbr-name));
+      if (cur == item_index_.end())
+	    return 0;
+
+      int type = cur->second->get_type_code();
+      if (type != vpiMemory && type != vpiNetArray)
+	    return 0;
+
+      char*end;
+      long idx = strtol(lbr+1, &end, 10);
+      if (end == lbr+1 || end != name+len-1)
+	    return 0;
+
+      return cur->second->vpi_index(idx);
+}
+
+__vpiScope*__vpiScope::find_child_scope(const char*name)
+{
+      index_names_();
+
+      map<string,__vpiScope*>::const_iterator cur = child_index_.find(name);
+      return cur == child_index_.end()? 0 : cur->second;
+}
+
 int __vpiScope::vpi_get(int code)
 {
       switch (code) {
@@ -557,6 +643,7 @@ compile_scope_decl(char*label, char*type, char*name, char*tname,
       scope->nitem = 0;
       scope->live_contexts = 0;
       scope->free_contexts = 0;
+      scope->context_size = 0;
 
       if (is_cell) scope->is_cell = true;
       else scope->is_cell = false;
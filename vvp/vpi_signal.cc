@@ -570,15 +570,15 @@ static int signal_get(int code, vpiHandle ref)
 		  return vpiUndefined;
 
 	  case vpiLeftRange:
-            return rfp->msb.get_value();
+            return rfp->msb;
 
 	  case vpiRightRange:
-            return rfp->lsb.get_value();
+            return rfp->lsb;
 
 	  case vpiScalar:
-	    return (rfp->msb.get_value() == 0 && rfp->lsb.get_value() == 0);
+	    return (rfp->msb == 0 && rfp->lsb == 0);
 	  case vpiVector:
-	    return (rfp->msb.get_value() != rfp->lsb.get_value());
+	    return (rfp->msb != rfp->lsb);
 
           case vpiAutomatic:
             return vpip_scope(rfp)->is_automatic() ? 1  : 0;
@@ -590,7 +590,7 @@ static int signal_get(int code, vpiHandle ref)
 
 	    // This private property must return zero when undefined.
 	  case _vpiNexusId:
-	    if (rfp->msb.get_value() == rfp->lsb.get_value())
+	    if (rfp->msb == rfp->lsb)
 		  return (int) (uintptr_t) rfp->node;
 	    else
 		  return 0;
@@ -645,9 +645,9 @@ static vpiHandle signal_get_handle(int code, vpiHandle ref)
 	    return rfp->is_netarray? rfp->id.index : 0;
 
 	  case vpiLeftRange:
-	    return &rfp->msb;
+	    return vpip_shared_dec_const(rfp->msb);
 	  case vpiRightRange:
-	    return &rfp->lsb;
+	    return vpip_shared_dec_const(rfp->lsb);
 
 	  case vpiScope:
 	    return vpip_scope(rfp);
@@ -686,30 +686,30 @@ void __vpiSignal::make_bits()
       for (unsigned idx = 0; idx < width(); idx += 1) {
 	    base[idx].bit0 = base;
 	    int real_idx;
-	    if (msb.get_value() >= lsb.get_value()) {
-		  real_idx = idx + lsb.get_value();
+	    if (msb >= lsb) {
+		  real_idx = idx + lsb;
 	    } else {
-		  real_idx = lsb.get_value() - idx;
+		  real_idx = lsb - idx;
 	    }
-	    base[idx].index = new __vpiDecConst(real_idx);
+	    base[idx].index = vpip_shared_dec_const(real_idx);
       }
 }
 
 vpiHandle __vpiSignal::get_index(int idx)
 {
 	/* Check to see if the index is in range. */
-      if (msb.get_value() >= lsb.get_value()) {
-	    if ((idx > msb.get_value()) || (idx < lsb.get_value())) return 0;
+      if (msb >= lsb) {
+	    if ((idx > msb) || (idx < lsb)) return 0;
       } else {
-	    if ((idx < msb.get_value()) || (idx > lsb.get_value())) return 0;
+	    if ((idx < msb) || (idx > lsb)) return 0;
       }
 
 	/* Normalize the index */
       unsigned norm_idx;
-      if (msb.get_value() >= lsb.get_value()) {
-	    norm_idx = idx - lsb.get_value();
+      if (msb >= lsb) {
+	    norm_idx = idx - lsb;
       } else {
-	    norm_idx = lsb.get_value() - idx;
+	    norm_idx = lsb - idx;
       }
 
       if (bits == NULL) make_bits();
@@ -820,9 +820,9 @@ static vpiHandle signal_index(int idx, vpiHandle ref)
 
 unsigned __vpiSignal::width(void) const
 {
-      unsigned wid = (msb.get_value() >= lsb.get_value())
-	    ? (msb.get_value() - lsb.get_value() + 1)
-	    : (lsb.get_value() - msb.get_value() + 1);
+      unsigned wid = (msb >= lsb)
+	    ? (msb - lsb + 1)
+	    : (lsb - msb + 1);
 
       return wid;
 }
@@ -964,9 +964,9 @@ static vpiHandle signal_put_value(vpiHandle ref, s_vpi_value*vp, int flags)
 	/* Make a vvp_vector4_t vector to receive the translated value
 	   that we are going to poke. This will get populated
 	   differently depending on the format. */
-      wid = (rfp->msb.get_value() >= rfp->lsb.get_value())
-	    ? (rfp->msb.get_value() - rfp->lsb.get_value() + 1)
-	    : (rfp->lsb.get_value() - rfp->msb.get_value() + 1);
+      wid = (rfp->msb >= rfp->lsb)
+	    ? (rfp->msb - rfp->lsb + 1)
+	    : (rfp->lsb - rfp->msb + 1);
 
       vvp_vector4_t val = vec4_from_vpi_value(vp, wid);
 
@@ -1226,9 +1226,6 @@ void signal_delete(vpiHandle item)
       obj->node->fil->clear_all_callbacks();
       vvp_net_delete(obj->node);
       if (obj->bits) {
-	    for (unsigned idx=0; idx<obj->width(); idx+=1) {
-		  delete obj->bits[idx].index;
-	    }
 	    obj->bits -= 1;
 	    delete [] obj->bits;
       }
@@ -1267,8 +1264,8 @@ static vpiHandle fill_in_net4(struct __vpiSignal*obj, __vpiScope*scope,
 			      bool signed_flag, vvp_net_t*node)
 {
       obj->id.name = name? vpip_name_string(name) : 0;
-      obj->msb = __vpiDecConst(msb);
-      obj->lsb = __vpiDecConst(lsb);
+      obj->msb = msb;
+      obj->lsb = lsb;
       obj->signed_flag = signed_flag? 1 : 0;
       obj->is_netarray = 0;
       obj->node = node;
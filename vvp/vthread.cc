@@ -306,6 +306,7 @@ struct vthread_s {
 	    }
 	    free(filenm_);
 	    filenm_ = 0;
+	    lineno_ = 0;
 	    assert(stack_vec4_.empty());
 	    assert(stack_real_.empty());
 	    assert(stack_str_.empty());
@@ -612,6 +613,29 @@ static void multiply_array_imm(unsigned long*res, unsigned long*val,
       }
 }
 
+static inline size_t context_align(size_t size)
+{
+      const size_t align = sizeof(uint64_t) > sizeof(void*)
+                         ? sizeof(uint64_t) : sizeof(void*);
+      return (size + align - 1) & ~(align - 1);
+}
+
+/*
+ * A context is allocated as a single block: the link slots and item
+ * pointers first, followed by the instances of all the items that
+ * are small enough to be placed in the block. This way a new frame
+ * of a recursive function or task costs one allocation instead of
+ * one per variable.
+ */
+static size_t context_block_size(__vpiScope*scope)
+{
+      size_t size = context_align((2 + scope->nitem) * sizeof(void*));
+      for (unsigned idx = 0 ; idx < scope->nitem ; idx += 1)
+            size += context_align(scope->item[idx]->instance_size());
+
+      return size;
+}
+
 /*
  * Allocate a context for use by a child thread. By preference, use
  * the last freed context. If none available, create a new one. Add
@@ -628,9 +652,21 @@ static vvp_context_t vthread_alloc_context(__vpiScope*scope)
                   scope->item[idx]->reset_instance(context);
             }
       } else {
-            context = vvp_allocate_context(scope->nitem);
+            if (scope->context_size == 0)
+                  scope->context_size = context_block_size(scope);
+
+            context = (vvp_context_t)malloc(scope->context_size);
+            char*mem = (char*)context
+                     + context_align((2 + scope->nitem) * sizeof(void*));
             for (unsigned idx = 0 ; idx < scope->nitem ; idx += 1) {
-                  scope->item[idx]->alloc_instance(context);
+                  automatic_hooks_s*item = scope->item[idx];
+                  size_t size = item->instance_size();
+                  if (size == 0) {
+                        item->alloc_instance(context);
+                  } else {
+                        item->place_instance(context, mem);
+                        mem += context_align(size);
+                  }
             }
       }
 
@@ -684,10 +720,29 @@ void contexts_delete(struct __vpiScope*scope)
 
 /*
  * Create a new thread with the given start address.
- */
+ *
+ * Thread objects are large (the flags array alone is 512 entries) and
+ * fork heavy designs create and destroy them at a very high rate, so
+ * finished threads are kept on a free list and handed back out by
+ * vthread_new(). A recycled thread also keeps the capacity of its
+ * stacks, so the common case does no heap allocation at all. The
+ * wait_next pointer is unused while a thread is on the free list, so
+ * it is used to link the list.
+ */
+static vthread_t thread_pool = 0;
+static unsigned thread_pool_cnt = 0;
+static const unsigned THREAD_POOL_MAX = 4096;
+
 vthread_t vthread_new(vvp_code_t pc, __vpiScope*scope)
 {
-      vthread_t thr = new struct vthread_s;
+      vthread_t thr;
+      if (thread_pool) {
+	    thr = thread_pool;
+	    thread_pool = thr->wait_next;
+	    thread_pool_cnt -= 1;
+      } else {
+	    thr = new struct vthread_s;
+      }
       thr->pc     = pc;
 	//thr->bits4  = vvp_vector4_t(32);
       thr->parent = 0;
@@ -771,6 +826,7 @@ static void vthread_reap(vthread_t thr)
 		  assert(child->parent == thr);
 		  child->parent = thr->parent;
 	    }
+	    thr->children.clear();
       }
       if (! thr->detached_children.empty()) {
 	    for (set<vthread_t>::iterator cur = thr->detached_children.begin()
@@ -782,6 +838,7 @@ static void vthread_reap(vthread_t thr)
 		  child->parent = 0;
 		  child->i_am_detached = 0;
 	    }
+	    thr->detached_children.clear();
       }
       if (thr->parent) {
 	      /* assert that the given element was removed. */
@@ -817,9 +874,35 @@ static void vthread_reap(vthread_t thr)
 void vthread_delete(vthread_t thr)
 {
       thr->cleanup();
-      delete thr;
+      if (thread_pool_cnt >= THREAD_POOL_MAX) {
+	    delete thr;
+	    return;
+      }
+
+	// A disabled thread may still list children that it has
+	// already handed off, so clear the sets before recycling.
+      thr->children.clear();
+      thr->detached_children.clear();
+      thr->args_real.clear();
+      thr->args_str.clear();
+      thr->args_vec4.clear();
+      thr->wait_next = thread_pool;
+      thread_pool = thr;
+      thread_pool_cnt += 1;
 }
 
+#ifdef CHECK_WITH_VALGRIND
+void vthread_pool_delete(void)
+{
+      while (thread_pool) {
+	    vthread_t tmp = thread_pool->wait_next;
+	    delete thread_pool;
+	    thread_pool = tmp;
+      }
+      thread_pool_cnt = 0;
+}
+#endif
+
 void vthread_mark_scheduled(vthread_t thr)
 {
       while (thr != 0) {
@@ -6371,6 +6454,16 @@ bool of_SUBSTR_VEC4(vthread_t thr, vvp_code_t cp)
       return true;
 }
 
+/*
+ * %cov <file> <line>
+ * Count an execution of the statement at this coverage point.
+ */
+bool of_COV(vthread_t, vvp_code_t cp)
+{
+      cp->number += 1;
+      return true;
+}
+
 bool of_FILE_LINE(vthread_t thr, vvp_code_t cp)
 {
       vpiHandle handle = cp->handle;
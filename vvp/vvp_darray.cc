@@ -231,55 +231,52 @@ vvp_darray_vec2::~vvp_darray_vec2()
 
 size_t vvp_darray_vec2::get_size(void) const
 {
-      return array_.size();
+      return size_;
 }
 
 void vvp_darray_vec2::set_word(unsigned adr, const vvp_vector4_t&value)
 {
-      if (adr >= array_.size()) return;
+      if (adr >= size_) return;
       assert(value.size() == word_wid_);
-      array_[adr] = value;
+
+	// Get the value bits, with any X or Z bits converted to 0.
+      unsigned long*bits = value.subarray(0, word_wid_, true);
+      unsigned long*dst = &array_[adr * word_cnt_];
+      for (unsigned idx = 0 ; idx < word_cnt_ ; idx += 1)
+	    dst[idx] = bits[idx];
+      delete[]bits;
 }
 
 void vvp_darray_vec2::get_word(unsigned adr, vvp_vector4_t&value)
 {
-	/*
-	 * Return a zero value for an out of range address or if the
-	 * value has not been written yet (has a size of zero).
-	 */
-      if ((adr >= array_.size()) || (array_[adr].size() == 0)) {
-	    value = vvp_vector4_t(word_wid_, BIT4_0);
+      value = vvp_vector4_t(word_wid_, BIT4_0);
+	// Return a zero value for an out of range address.
+      if (adr >= size_)
 	    return;
-      }
-      assert(array_[adr].size() == word_wid_);
-      value.resize(word_wid_);
-      for (unsigned idx = 0; idx < word_wid_; idx += 1) {
-	    value.set_bit(idx, array_[adr].value4(idx));
-      }
+
+      value.setarray(0, word_wid_, &array_[adr * word_cnt_]);
 }
 
 void vvp_darray_vec2::shallow_copy(const vvp_object*obj)
 {
       const vvp_darray_vec2*that = dynamic_cast<const vvp_darray_vec2*>(obj);
       assert(that);
+      assert(word_cnt_ == that->word_cnt_);
 
-      unsigned num_items = min(array_.size(), that->array_.size());
-      for (unsigned idx = 0 ; idx < num_items ; idx += 1)
+      size_t num_items = min(size_, that->size_);
+      for (size_t idx = 0 ; idx < num_items * word_cnt_ ; idx += 1)
 	    array_[idx] = that->array_[idx];
 }
 
 vvp_vector4_t vvp_darray_vec2::get_bitstream(bool)
 {
-      vvp_vector4_t vec(array_.size() * word_wid_, BIT4_0);
+      vvp_vector4_t vec(size_ * word_wid_, BIT4_0);
 
       unsigned adx = 0;
       unsigned vdx = vec.size();
       while (vdx > 0) {
             vdx -= word_wid_;
-            for (unsigned bdx = 0; bdx < word_wid_; bdx += 1) {
-                  if (array_[adx].value(bdx))
-                        vec.set_bit(vdx+bdx, BIT4_1);
-            }
+	    vec.setarray(vdx, word_wid_, &array_[adx * word_cnt_]);
             adx++;
       }
 
@@ -84,11 +84,19 @@ class vvp_darray_vec4 : public vvp_darray {
       unsigned word_wid_;
 };
 
+/*
+ * The words of a 2-state array are packed end to end in a single
+ * vector of unsigned long, each word taking a whole number of
+ * unsigned longs. Only the value bits are stored, and the array
+ * starts out all zero, as 2-state arrays should.
+ */
 class vvp_darray_vec2 : public vvp_darray {
 
     public:
       inline vvp_darray_vec2(size_t siz, unsigned word_wid) :
-                             array_(siz), word_wid_(word_wid) { }
+                             size_(siz), word_wid_(word_wid),
+                             word_cnt_((word_wid + BITS_PER_WORD-1) / BITS_PER_WORD),
+                             array_(siz * word_cnt_, 0) { }
       ~vvp_darray_vec2();
 
       size_t get_size(void) const;
@@ -98,8 +106,12 @@ class vvp_darray_vec2 : public vvp_darray {
       vvp_vector4_t get_bitstream(bool as_vec4);
 
     private:
-      std::vector<vvp_vector2_t> array_;
+      enum { BITS_PER_WORD = 8*sizeof(unsigned long) };
+      size_t size_;
       unsigned word_wid_;
+	// The number of unsigned longs used by each word.
+      unsigned word_cnt_;
+      std::vector<unsigned long> array_;
 };
 
 class vvp_darray_real : public vvp_darray {
@@ -38,7 +38,7 @@ static bool at_EOS = false;
 
 void island_send_value(vvp_net_t*net, const vvp_vector8_t&val)
 {
-      vvp_island_port*fun = dynamic_cast<vvp_island_port*>(net->fun);
+      vvp_island_port*fun = static_cast<vvp_island_port*>(net->fun);
       if (fun->outvalue .eeq(val))
 	    return;
 
@@ -79,6 +79,10 @@ void vvp_island::flag_island()
       flagged_ = true;
 }
 
+void vvp_island::mark_port(vvp_island_port*)
+{
+}
+
 /*
 * This method handles the callback from the scheduler. It does basic
 * housecleaning and calls the run_island() method implemented by the
@@ -180,6 +184,7 @@ void vvp_island_port::recv_vec4(vvp_net_ptr_t, const vvp_vector4_t&bit,
 	    return;
 
       invalue = tmp;
+      island_->mark_port(this);
       island_->flag_island();
 }
 
@@ -197,6 +202,7 @@ void vvp_island_port::recv_vec8(vvp_net_ptr_t, const vvp_vector8_t&bit)
 	    return;
 
       invalue = bit;
+      island_->mark_port(this);
       island_->flag_island();
 }
 
@@ -215,11 +221,13 @@ void vvp_island_port::recv_vec8_pv(vvp_net_ptr_t, const vvp_vector8_t&bit,
 	    }
       }
 
+      island_->mark_port(this);
       island_->flag_island();
 }
 
 void vvp_island_port::force_flag(bool run_now)
 {
+      island_->mark_port(this);
       if (run_now)
 	    island_->run_island();
       else
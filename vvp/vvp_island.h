@@ -69,6 +69,12 @@ class vvp_island  : private vvp_gen_event_s {
 	// scheduler to process whatever happened.
       void flag_island();
 
+	// Ports call this method before flagging the island to say
+	// which port saw new input. Islands that can limit the work
+	// done by run_island() to the affected part of the mesh use
+	// this to keep track of what needs to be rerun.
+      virtual void mark_port(vvp_island_port*port);
+
 	// This is the method that is called, eventually, to process
 	// whatever happened. The derived island class implements this
 	// method to give the island its character.
@@ -162,7 +168,7 @@ class vvp_island_port  : public vvp_net_fun_t {
 
 inline vvp_vector8_t island_get_value(vvp_net_t*net)
 {
-      vvp_island_port*fun = dynamic_cast<vvp_island_port*>(net->fun);
+      vvp_island_port*fun = static_cast<vvp_island_port*>(net->fun);
       vvp_wire_vec8*fil = dynamic_cast<vvp_wire_vec8*>(net->fil);
 
       if (fil == 0) {
@@ -185,7 +191,7 @@ inline vvp_vector8_t island_get_value(vvp_net_t*net)
 
 inline vvp_vector8_t island_get_sent_value(vvp_net_t*net)
 {
-      vvp_island_port*fun = dynamic_cast<vvp_island_port*>(net->fun);
+      vvp_island_port*fun = static_cast<vvp_island_port*>(net->fun);
       return fun->outvalue;
 }
 
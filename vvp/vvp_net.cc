@@ -237,6 +237,39 @@ void vvp_net_t::unlink(vvp_net_ptr_t dst_ptr)
       net->port[net_port] = vvp_net_ptr_t(0,0);
 }
 
+bool vvp_net_t::splice_fanout(vvp_net_ptr_t dst_ptr, vvp_net_t*from)
+{
+	/* Locate the list slot that points at the port. */
+      vvp_net_ptr_t*slot = &out_;
+      while (!slot->nil() && *slot != dst_ptr)
+	    slot = &slot->ptr()->port[slot->port()];
+
+      if (slot->nil())
+	    return false;
+
+	/* Take the port out of the list, remembering the rest. */
+      vvp_net_t*net = dst_ptr.ptr();
+      vvp_net_ptr_t rest = net->port[dst_ptr.port()];
+      net->port[dst_ptr.port()] = vvp_net_ptr_t(0,0);
+
+      if (from->out_.nil()) {
+	    *slot = rest;
+	    return true;
+      }
+
+	/* Put the fan-out of the "from" net in its place, keeping
+	   the order of the fan-out so that values are delivered in
+	   the same order as before. */
+      vvp_net_ptr_t tail = from->out_;
+      while (! tail.ptr()->port[tail.port()].nil())
+	    tail = tail.ptr()->port[tail.port()];
+
+      tail.ptr()->port[tail.port()] = rest;
+      *slot = from->out_;
+      from->out_ = vvp_net_ptr_t(0,0);
+      return true;
+}
+
 void vvp_net_t::count_drivers(unsigned idx, unsigned counts[4])
 {
       counts[0] = 0;
@@ -3664,11 +3697,103 @@ unsigned vvp_switch_strength_map[2][8] = {
       }
 };
 
-vvp_vector4_t reduce4(const vvp_vector8_t&that)
+/*
+ * The vector resolve functions run through the raw scalar encodings
+ * of the operands a byte at a time, using the inline scalar resolve()
+ * so that only bits where neither value is HiZ and the values differ
+ * go through the full resolution rules. Identical vectors (a common
+ * case for multiply driven nets that agree) are not looked at bit by
+ * bit at all.
+ */
+vvp_vector8_t resolve(const vvp_vector8_t&a, const vvp_vector8_t&b)
 {
-      vvp_vector4_t out (that.size());
+      assert(a.size() == b.size());
+      if (a.eeq(b))
+	    return a;
+
+      vvp_vector8_t out (a.size());
+      const unsigned char*ap = a.raw_bits_();
+      const unsigned char*bp = b.raw_bits_();
+      unsigned char*op = out.raw_bits_();
+
       for (unsigned idx = 0 ;  idx < out.size() ;  idx += 1)
-	    out.set_bit(idx, that.value(idx).value());
+	    op[idx] = resolve(vvp_scalar_t(ap[idx]), vvp_scalar_t(bp[idx])).raw();
+
+      return out;
+}
+
+vvp_vector8_t resolve(const vvp_vector8_t&a, vvp_scalar_t b)
+{
+      if (b.is_hiz())
+	    return a;
+
+      vvp_vector8_t out (a.size());
+      const unsigned char*ap = a.raw_bits_();
+      unsigned char*op = out.raw_bits_();
+
+      for (unsigned idx = 0 ;  idx < out.size() ;  idx += 1)
+	    op[idx] = resolve(vvp_scalar_t(ap[idx]), b).raw();
+
+      return out;
+}
+
+/*
+ * Convert the vector a word of vvp_vector4_t bits at a time, going
+ * straight from the raw scalar encoding to the a/b bit encoding.
+ */
+vvp_vector4_t reduce4(const vvp_vector8_t&that)
+{
+      unsigned size = that.size();
+      vvp_vector4_t out (size, BIT4_0);
+      if (size == 0)
+	    return out;
+
+      const unsigned char*src = that.raw_bits_();
+      unsigned long*abits;
+      unsigned long*bbits;
+      if (size > vvp_vector4_t::BITS_PER_WORD) {
+	    abits = out.abits_ptr_;
+	    bbits = out.bbits_ptr_;
+      } else {
+	    abits = &out.abits_val_;
+	    bbits = &out.bbits_val_;
+      }
+
+      for (unsigned base = 0 ; base < size ; base += vvp_vector4_t::BITS_PER_WORD) {
+	    unsigned cnt = size - base;
+	    if (cnt > vvp_vector4_t::BITS_PER_WORD)
+		  cnt = vvp_vector4_t::BITS_PER_WORD;
+
+	    unsigned long aword = 0, bword = 0;
+	    for (unsigned idx = 0 ; idx < cnt ; idx += 1) {
+		  unsigned char raw = src[base+idx];
+		  unsigned long abit, bbit;
+		  if ((raw & 0x77) == 0) {
+			  // BIT4_Z
+			abit = 0;
+			bbit = 1;
+		  } else switch (raw & 0x88) {
+		      case 0x00: // BIT4_0
+			abit = 0;
+			bbit = 0;
+			break;
+		      case 0x88: // BIT4_1
+			abit = 1;
+			bbit = 0;
+			break;
+		      default:   // BIT4_X
+			abit = 1;
+			bbit = 1;
+			break;
+		  }
+		  aword |= abit << idx;
+		  bword |= bbit << idx;
+	    }
+
+	    unsigned wdx = base / vvp_vector4_t::BITS_PER_WORD;
+	    abits[wdx] = aword;
+	    bbits[wdx] = bword;
+      }
 
       return out;
 }
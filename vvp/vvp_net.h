@@ -117,6 +117,15 @@ struct automatic_hooks_s {
 
       virtual void alloc_instance(vvp_context_t context) = 0;
       virtual void reset_instance(vvp_context_t context) = 0;
+
+	/* Items with a small, fixed size instance can have it placed
+	   in the context block itself instead of allocated on its
+	   own. instance_size() returns the number of bytes needed, or
+	   0 if the item allocates its own storage. place_instance()
+	   constructs the instance in the given memory. */
+      virtual size_t instance_size() const { return 0; }
+      virtual void place_instance(vvp_context_t context, void*)
+      { alloc_instance(context); }
 #ifdef CHECK_WITH_VALGRIND
       virtual void free_instance(vvp_context_t context) = 0;
 #endif
@@ -241,8 +250,10 @@ extern unsigned long multiply_with_carry(unsigned long a, unsigned long b,
 class vvp_vector4_t {
 
       friend vvp_vector4_t operator ~(const vvp_vector4_t&that);
+      friend vvp_vector4_t reduce4(const vvp_vector8_t&that);
       friend class vvp_vector4array_t;
       friend class vvp_vector4array_sa;
+      friend class vvp_vector4array_sparse;
       friend class vvp_vector4array_aa;
 
     public:
@@ -800,6 +811,8 @@ inline vvp_vector2_t vvp_vector2_t::subvalue(unsigned base, unsigned wid) const
 class vvp_scalar_t {
 
       friend vvp_scalar_t fully_featured_resolv_(vvp_scalar_t a, vvp_scalar_t b);
+      friend vvp_vector8_t resolve(const vvp_vector8_t&a, const vvp_vector8_t&b);
+      friend vvp_vector8_t resolve(const vvp_vector8_t&a, vvp_scalar_t b);
 
     public:
 	// Make a HiZ value.
@@ -906,6 +919,9 @@ extern std::ostream& operator<< (std::ostream&, vvp_scalar_t);
 class vvp_vector8_t {
 
       friend vvp_vector8_t part_expand(const vvp_vector8_t&, unsigned, unsigned);
+      friend vvp_vector8_t resolve(const vvp_vector8_t&a, const vvp_vector8_t&b);
+      friend vvp_vector8_t resolve(const vvp_vector8_t&a, vvp_scalar_t b);
+      friend vvp_vector4_t reduce4(const vvp_vector8_t&that);
 
     public:
       explicit vvp_vector8_t(unsigned size =0);
@@ -936,6 +952,14 @@ class vvp_vector8_t {
       vvp_vector8_t(const vvp_vector8_t&that);
       vvp_vector8_t& operator= (const vvp_vector8_t&that);
 
+    private:
+	// The resolution and reduction functions work directly on
+	// the raw scalar encodings, a byte per bit.
+      unsigned char*raw_bits_()
+      { return size_ <= sizeof(val_) ? val_ : ptr_; }
+      const unsigned char*raw_bits_() const
+      { return size_ <= sizeof(val_) ? val_ : ptr_; }
+
     private:
       unsigned size_;
       union {
@@ -945,18 +969,10 @@ class vvp_vector8_t {
 };
 
   /* Resolve uses the default Verilog resolver algorithm to resolve
-     two drive vectors to a single output. */
-inline vvp_vector8_t resolve(const vvp_vector8_t&a, const vvp_vector8_t&b)
-{
-      assert(a.size() == b.size());
-      vvp_vector8_t out (a.size());
-
-      for (unsigned idx = 0 ;  idx < out.size() ;  idx += 1) {
-	    out.set_bit(idx, resolve(a.value(idx), b.value(idx)));
-      }
-
-      return out;
-}
+     two drive vectors to a single output. The second form resolves
+     every bit of the vector with the same scalar value. */
+extern vvp_vector8_t resolve(const vvp_vector8_t&a, const vvp_vector8_t&b);
+extern vvp_vector8_t resolve(const vvp_vector8_t&a, vvp_scalar_t b);
 
   /* This lookup tabke implements the strength reduction implied by
      Verilog standard switch devices. The major dimension selects
@@ -1129,6 +1145,11 @@ class vvp_net_t {
       void link(vvp_net_ptr_t port);
 	// Disconnect the port from the output of this net.
       void unlink(vvp_net_ptr_t port);
+	// Replace the port in the fan-out of this net with the entire
+	// fan-out of the "from" net, which is left with no fan-out.
+	// Return false (and change nothing) if this net does not
+	// drive the port.
+      bool splice_fanout(vvp_net_ptr_t port, vvp_net_t*from);
 
     public: // Methods to propagate output from this node.
       void send_vec4(const vvp_vector4_t&val, vvp_context_t context);
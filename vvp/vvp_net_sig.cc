@@ -359,12 +359,24 @@ void vvp_fun_signal4_aa::reset_instance(vvp_context_t context)
       bits->set_to_x();
 }
 
+size_t vvp_fun_signal4_aa::instance_size() const
+{
+      return sizeof(vvp_vector4_t);
+}
+
+void vvp_fun_signal4_aa::place_instance(vvp_context_t context, void*mem)
+{
+      vvp_set_context_item(context, context_idx_,
+                           new (mem) vvp_vector4_t(size_));
+}
+
 #ifdef CHECK_WITH_VALGRIND
 void vvp_fun_signal4_aa::free_instance(vvp_context_t context)
 {
       vvp_vector4_t*bits = static_cast<vvp_vector4_t*>
             (vvp_get_context_item(context, context_idx_));
-      delete bits;
+	/* The instance lives in the context block. */
+      bits->~vvp_vector4_t();
 }
 #endif
 
@@ -520,12 +532,20 @@ void vvp_fun_signal_real_aa::reset_instance(vvp_context_t context)
       *bits = 0.0;
 }
 
+size_t vvp_fun_signal_real_aa::instance_size() const
+{
+      return sizeof(double);
+}
+
+void vvp_fun_signal_real_aa::place_instance(vvp_context_t context, void*mem)
+{
+      vvp_set_context_item(context, context_idx_, new (mem) double(0.0));
+}
+
 #ifdef CHECK_WITH_VALGRIND
-void vvp_fun_signal_real_aa::free_instance(vvp_context_t context)
+void vvp_fun_signal_real_aa::free_instance(vvp_context_t)
 {
-      double*bits = static_cast<double*>
-            (vvp_get_context_item(context, context_idx_));
-      delete bits;
+	/* The instance lives in the context block. */
 }
 #endif
 
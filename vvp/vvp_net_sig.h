@@ -165,6 +165,8 @@ class vvp_fun_signal4_aa : public vvp_fun_signal_vec, public automatic_signal_ba
 
       void alloc_instance(vvp_context_t context);
       void reset_instance(vvp_context_t context);
+      size_t instance_size() const;
+      void place_instance(vvp_context_t context, void*mem);
 #ifdef CHECK_WITH_VALGRIND
       void free_instance(vvp_context_t context);
 #endif
@@ -230,6 +232,8 @@ class vvp_fun_signal_real_aa : public vvp_fun_signal_real, public automatic_sign
 
       void alloc_instance(vvp_context_t context);
       void reset_instance(vvp_context_t context);
+      size_t instance_size() const;
+      void place_instance(vvp_context_t context, void*mem);
 #ifdef CHECK_WITH_VALGRIND
       void free_instance(vvp_context_t context);
 #endif
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "vvp_sparse_array.h"
+# include  "statistics.h"
+# include  <cassert>
+
+unsigned long count_sparse_array_pages = 0;
+
+vvp_vector4array_sparse::vvp_vector4array_sparse(unsigned width__, unsigned words__)
+: vvp_vector4array_t(width__, words__)
+{
+      unsigned pages = words_ / PAGE_WORDS + (words_ % PAGE_WORDS ? 1 : 0);
+      dir_size_ = pages / BLOCK_PAGES + (pages % BLOCK_PAGES ? 1 : 0);
+      dir_ = new v4cell**[dir_size_];
+      for (unsigned idx = 0 ; idx < dir_size_ ; idx += 1)
+	    dir_[idx] = 0;
+}
+
+vvp_vector4array_sparse::~vvp_vector4array_sparse()
+{
+      for (unsigned blk = 0 ; blk < dir_size_ ; blk += 1) {
+	    if (dir_[blk] == 0)
+		  continue;
+	    for (unsigned pg = 0 ; pg < BLOCK_PAGES ; pg += 1) {
+		  v4cell*cells = dir_[blk][pg];
+		  if (cells == 0)
+			continue;
+		  if (width_ > vvp_vector4_t::BITS_PER_WORD) {
+			for (unsigned idx = 0 ; idx < PAGE_WORDS ; idx += 1)
+			      if (cells[idx].abits_ptr_)
+				    delete[]cells[idx].abits_ptr_;
+		  }
+		  delete[]cells;
+	    }
+	    delete[]dir_[blk];
+      }
+      delete[]dir_;
+}
+
+inline vvp_vector4array_t::v4cell* vvp_vector4array_sparse::find_page_(unsigned page) const
+{
+      v4cell**block = dir_[page / BLOCK_PAGES];
+      return block ? block[page % BLOCK_PAGES] : 0;
+}
+
+vvp_vector4array_t::v4cell* vvp_vector4array_sparse::new_page_(unsigned page)
+{
+      v4cell**&block = dir_[page / BLOCK_PAGES];
+      if (block == 0) {
+	    block = new v4cell*[BLOCK_PAGES];
+	    for (unsigned idx = 0 ; idx < BLOCK_PAGES ; idx += 1)
+		  block[idx] = 0;
+      }
+
+      v4cell*cells = new v4cell[PAGE_WORDS];
+      if (width_ <= vvp_vector4_t::BITS_PER_WORD) {
+	    for (unsigned idx = 0 ; idx < PAGE_WORDS ; idx += 1) {
+		  cells[idx].abits_val_ = vvp_vector4_t::WORD_X_ABITS;
+		  cells[idx].bbits_val_ = vvp_vector4_t::WORD_X_BBITS;
+	    }
+      } else {
+	    for (unsigned idx = 0 ; idx < PAGE_WORDS ; idx += 1) {
+		  cells[idx].abits_ptr_ = 0;
+		  cells[idx].bbits_ptr_ = 0;
+	    }
+      }
+
+      block[page % BLOCK_PAGES] = cells;
+      count_sparse_array_pages += 1;
+      return cells;
+}
+
+void vvp_vector4array_sparse::set_word(unsigned index, const vvp_vector4_t&that)
+{
+      assert(index < words_);
+
+      unsigned page = index / PAGE_WORDS;
+      v4cell*cells = find_page_(page);
+      if (cells == 0)
+	    cells = new_page_(page);
+
+      set_word_(cells + index % PAGE_WORDS, that);
+}
+
+vvp_vector4_t vvp_vector4array_sparse::get_word(unsigned index) const
+{
+      if (index >= words_)
+	    return vvp_vector4_t(width_, BIT4_X);
+
+      v4cell*cells = find_page_(index / PAGE_WORDS);
+      if (cells == 0)
+	    return vvp_vector4_t(width_, BIT4_X);
+
+      return get_word_(cells + index % PAGE_WORDS);
+}
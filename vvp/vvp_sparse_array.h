@@ -0,0 +1,58 @@
+#ifndef IVL_vvp_sparse_array_H
+#define IVL_vvp_sparse_array_H
+/*
+ * Copyright (c) 2026 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "vvp_net.h"
+
+/*
+ * Statically allocated vvp_vector4array_t for very large arrays. These
+ * are usually only lightly used, so the words are kept in pages of 256
+ * cells (4K bytes for words of up to 64 bits) that are created, X
+ * filled, the first time a word in the page is written. Reading a word
+ * from a page that does not yet exist returns X.
+ *
+ * The pages are found through a two level directory: the top level has
+ * one slot per block of 1024 pages, and the blocks are also allocated
+ * when first written. A lookup is two indexed loads, whatever the
+ * number of resident pages.
+ */
+class vvp_vector4array_sparse : public vvp_vector4array_t {
+
+    public:
+      vvp_vector4array_sparse(unsigned width, unsigned words);
+      ~vvp_vector4array_sparse();
+
+      vvp_vector4_t get_word(unsigned idx) const;
+      void set_word(unsigned idx, const vvp_vector4_t&that);
+
+      static unsigned page_words() { return PAGE_WORDS; }
+
+    private:
+      enum { PAGE_WORDS = 256, BLOCK_PAGES = 1024 };
+
+      v4cell*find_page_(unsigned page) const;
+      v4cell*new_page_(unsigned page);
+
+	// dir_[n] is nil or the block for pages n*BLOCK_PAGES and up.
+      v4cell***dir_;
+      unsigned dir_size_;
+};
+
+#endif /* IVL_vvp_sparse_array_H */
@@ -232,7 +232,8 @@ vvp_net_t* create_constant_node(const char*val_str)
       if (c4string_test(val_str)) {
 	    vvp_net_t*net = new vvp_net_t;
 	    net->fun = new vvp_fun_bufz;
-	    schedule_init_vector(vvp_net_ptr_t(net,0), c4string_to_vector4(val_str));
+	    schedule_init_const_vector(vvp_net_ptr_t(net,0),
+				       compile_const_vector4(val_str));
 	    return net;
       }
 